@@ -0,0 +1,69 @@
+#pragma once
+/* ============================================================
+ *  BandMatrix.h  – macierz pasmowa w zwartym zapisie
+ *
+ *  p – szerokość pasma pod przekątną, q – nad przekątną.
+ *  Wiersz i zajmuje p+q+1 kolejnych komórek:
+ *      A[i][j]  →  a[ i*(p+q+1) + (j - i + p) ],   -p ≤ j-i ≤ q
+ *  Pamięć O(n·(p+q+1)).
+ * ============================================================ */
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+#include "DenseMatrix.h"
+
+template<typename T>
+class BandMatrix
+{
+public:
+    BandMatrix() = default;
+
+    BandMatrix(int n, int p, int q)
+        : n_(n), p_(p), q_(q),
+          a(storageSize(n, p, q), T(0))
+    {}
+
+    /* wycięcie pasma z pełnej macierzy (reszta jest pomijana) */
+    BandMatrix(const DenseMatrix<T>& A, int p, int q)
+        : BandMatrix(A.rows(), p, q)
+    {
+        for (int i = 0; i < n_; ++i)
+            for (int j = first(i); j <= last(i); ++j)
+                (*this)(i, j) = A(i, j);
+    }
+
+    int size()  const { return n_; }
+    int lower() const { return p_; }
+    int upper() const { return q_; }
+
+    /* zakres kolumn wiersza i leżący w paśmie */
+    int first(int i) const { return i - p_ > 0 ? i - p_ : 0; }
+    int last (int i) const { return i + q_ < n_ - 1 ? i + q_ : n_ - 1; }
+
+    bool inBand(int i, int j) const { return j - i >= -p_ && j - i <= q_; }
+
+    T& operator()(int i, int j)
+    {
+        return a[std::size_t(i) * (p_ + q_ + 1) + (j - i + p_)];
+    }
+    const T& operator()(int i, int j) const
+    {
+        return a[std::size_t(i) * (p_ + q_ + 1) + (j - i + p_)];
+    }
+
+    T*       data()       { return a.data(); }
+    const T* data() const { return a.data(); }
+
+private:
+    /* sprawdzenie PRZED alokacją – ujemne n·(p+q+1) jako size_t
+       dałoby bad_alloc zamiast czytelnego błędu */
+    static std::size_t storageSize(int n, int p, int q)
+    {
+        if (n < 0 || p < 0 || q < 0)
+            throw std::invalid_argument("BandMatrix: ujemny rozmiar");
+        return static_cast<std::size_t>(n) * (std::size_t(p) + q + 1);
+    }
+
+    int n_ = 0, p_ = 0, q_ = 0;
+    std::vector<T, AlignedAllocator<T>> a;
+};
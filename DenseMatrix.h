@@ -0,0 +1,123 @@
+#pragma once
+/* ============================================================
+ *  DenseMatrix.h  – gęsta macierz w jednym, wyrównanym bloku
+ *
+ *  Zamiast std::vector<std::vector<T>> (osobny blok na każdy
+ *  wiersz) wszystkie elementy leżą w jednej tablicy wyrównanej
+ *  do linii cache.  Układ wierszowy (RowMajor, domyślny – tego
+ *  używa Solver) albo kolumnowy (ColMajor).
+ * ============================================================ */
+#include <vector>
+#include <new>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <initializer_list>
+
+/* --- alokator z wyrównaniem (domyślnie 64 B = linia cache) --- */
+template<typename T, std::size_t Align = 64>
+struct AlignedAllocator
+{
+    using value_type = T;
+    static constexpr std::align_val_t alignment{
+        Align < alignof(T) ? alignof(T) : Align };
+
+    template<typename U> struct rebind { using other = AlignedAllocator<U, Align>; };
+
+    AlignedAllocator() noexcept = default;
+    template<typename U>
+    AlignedAllocator(const AlignedAllocator<U, Align>&) noexcept {}
+
+    T* allocate(std::size_t n)
+    {
+        return static_cast<T*>(::operator new(n * sizeof(T), alignment));
+    }
+    void deallocate(T* p, std::size_t) noexcept
+    {
+        ::operator delete(p, alignment);
+    }
+
+    template<typename U>
+    bool operator==(const AlignedAllocator<U, Align>&) const noexcept { return true; }
+    template<typename U>
+    bool operator!=(const AlignedAllocator<U, Align>&) const noexcept { return false; }
+};
+
+enum class Layout { RowMajor, ColMajor };
+
+/* ======================================================================== */
+template<typename T, Layout L = Layout::RowMajor>
+class DenseMatrix
+{
+public:
+    DenseMatrix() = default;
+
+    DenseMatrix(int rows, int cols, const T& v = T(0))
+        : r(rows), c(cols), a(static_cast<std::size_t>(rows) * cols, v) {}
+
+    /* {{a11, a12}, {a21, a22}} – zawsze podawane wierszami */
+    DenseMatrix(std::initializer_list<std::initializer_list<T>> rowsList)
+        : DenseMatrix(static_cast<int>(rowsList.size()),
+                      rowsList.size() ? static_cast<int>(rowsList.begin()->size()) : 0)
+    {
+        int i = 0;
+        for (const auto& row : rowsList) {
+            if (static_cast<int>(row.size()) != c)
+                throw std::invalid_argument("DenseMatrix: wiersze różnej długości");
+            int j = 0;
+            for (const T& v : row) (*this)(i, j++) = v;
+            ++i;
+        }
+    }
+
+    /* zgodność ze starym Matrix<T> = vector<vector<T>> */
+    explicit DenseMatrix(const std::vector<std::vector<T>>& rowsVec)
+        : DenseMatrix(static_cast<int>(rowsVec.size()),
+                      rowsVec.empty() ? 0 : static_cast<int>(rowsVec[0].size()))
+    {
+        for (int i = 0; i < r; ++i) {
+            if (static_cast<int>(rowsVec[i].size()) != c)
+                throw std::invalid_argument("DenseMatrix: wiersze różnej długości");
+            for (int j = 0; j < c; ++j) (*this)(i, j) = rowsVec[i][j];
+        }
+    }
+
+    /* zmiana układu (RowMajor ↔ ColMajor) – jawna kopia */
+    template<Layout M, typename = std::enable_if_t<M != L>>
+    explicit DenseMatrix(const DenseMatrix<T, M>& o)
+        : DenseMatrix(o.rows(), o.cols())
+    {
+        for (int i = 0; i < r; ++i)
+            for (int j = 0; j < c; ++j) (*this)(i, j) = o(i, j);
+    }
+
+    int rows() const { return r; }
+    int cols() const { return c; }
+    int size() const { return r; }            // jak vector<vector>::size()
+    int ld()   const { return L == Layout::RowMajor ? c : r; }
+
+    T*       data()       { return a.data(); }
+    const T* data() const { return a.data(); }
+
+    T& operator()(int i, int j)
+    {
+        return a[L == Layout::RowMajor ? std::size_t(i) * c + j
+                                       : std::size_t(j) * r + i];
+    }
+    const T& operator()(int i, int j) const
+    {
+        return a[L == Layout::RowMajor ? std::size_t(i) * c + j
+                                       : std::size_t(j) * r + i];
+    }
+
+    /* A[i][j] – tylko w układzie wierszowym (wiersz jest ciągły) */
+    template<Layout M = L, typename = std::enable_if_t<M == Layout::RowMajor>>
+    T* operator[](int i) { return a.data() + std::size_t(i) * c; }
+
+    template<Layout M = L, typename = std::enable_if_t<M == Layout::RowMajor>>
+    const T* operator[](int i) const { return a.data() + std::size_t(i) * c; }
+
+private:
+    int r = 0, c = 0;
+    std::vector<T, AlignedAllocator<T>> a;
+};
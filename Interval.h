@@ -23,6 +23,8 @@
 #include <fstream>
 #include <float.h>
 #include <typeinfo>
+#include <type_traits>
+#include <vector>
 #include <mpfr.h>
 #include <mpreal.h>
 
@@ -90,10 +92,10 @@ public:
 	T a;
 	T b;
 	Interval();
-	Interval(Interval const &copy);
+	Interval(Interval const &copy) = default;
 	Interval(T a, T b);
-	virtual ~Interval();
-	Interval& operator=(const Interval<T> i);
+	~Interval() = default;
+	Interval& operator=(const Interval<T> &i) = default;
 	Interval operator+(const Interval<T> &i);
 	Interval operator-(const Interval<T> &i);
 	Interval operator*(const Interval<T> &i);
@@ -149,22 +151,12 @@ public:
 	friend int SetRounding<T>(int rounding);
 };
 
-template<typename T>
-inline Interval<T>::~Interval() {
-}
-
 template<typename T>
 Interval<T>::Interval() {
 	this->a = 0;
 	this->b = 0;
 }
 
-template<typename T>
-Interval<T>::Interval(Interval const &copy) {
-	this->a = copy.a;
-	this->b = copy.b;
-}
-
 template<typename T>
 inline Interval<T>::Interval(T a, T b) {
 	this->a = a;
@@ -194,13 +186,6 @@ int SetRounding(int rounding) {
 	return rounding;
 }
 
-template<typename T>
-inline Interval<T>& Interval<T>::operator =(Interval<T> i) {
-	std::swap(this->a, i.a);
-	std::swap(this->b, i.b);
-	return *this;
-}
-
 template<typename T>
 inline void Interval<T>::SetPrecision(IAPrecision p) {
 	mpreal::set_default_prec(p);
@@ -770,79 +755,307 @@ Interval<T> ISub(const Interval<T> &x, const Interval<T> &y) {
 	return r;
 }
 
+// Nine-case sign classification of x*y: (l1, l2) are the factors of the
+// lower end and (u1, u2) of the upper end.  Returns true for the case of
+// both intervals containing 0, where the ends are min(a*d, b*c) and
+// max(a*c, b*d) and the second candidates are x.b*y.a and x.b*y.b.
+template<typename T>
+inline bool IMulCase(const Interval<T> &x, const Interval<T> &y, const T *&l1,
+		const T *&l2, const T *&u1, const T *&u2) {
+	if (x.a >= 0) {
+		if (y.a >= 0) {
+			l1 = &x.a; l2 = &y.a; u1 = &x.b; u2 = &y.b;
+		} else if (y.b <= 0) {
+			l1 = &x.b; l2 = &y.a; u1 = &x.a; u2 = &y.b;
+		} else {
+			l1 = &x.b; l2 = &y.a; u1 = &x.b; u2 = &y.b;
+		}
+	} else if (x.b <= 0) {
+		if (y.a >= 0) {
+			l1 = &x.a; l2 = &y.b; u1 = &x.b; u2 = &y.a;
+		} else if (y.b <= 0) {
+			l1 = &x.b; l2 = &y.b; u1 = &x.a; u2 = &y.a;
+		} else {
+			l1 = &x.a; l2 = &y.b; u1 = &x.a; u2 = &y.a;
+		}
+	} else {
+		if (y.a >= 0) {
+			l1 = &x.a; l2 = &y.b; u1 = &x.b; u2 = &y.b;
+		} else if (y.b <= 0) {
+			l1 = &x.b; l2 = &y.a; u1 = &x.a; u2 = &y.a;
+		} else {
+			l1 = &x.a; l2 = &y.b; u1 = &x.a; u2 = &y.a;
+			return true;
+		}
+	}
+	return false;
+}
+
+// lower / upper end of x*y under the rounding mode set by the caller
+template<typename T>
+inline T IMulLo(const Interval<T> &x, const Interval<T> &y) {
+	const T *l1, *l2, *u1, *u2;
+	const bool mixed = IMulCase(x, y, l1, l2, u1, u2);
+	T r = *l1 * *l2;
+	if (mixed) {
+		T t = x.b * y.a;
+		if (t < r)
+			r = t;
+	}
+	return r;
+}
+
+template<typename T>
+inline T IMulHi(const Interval<T> &x, const Interval<T> &y) {
+	const T *l1, *l2, *u1, *u2;
+	const bool mixed = IMulCase(x, y, l1, l2, u1, u2);
+	T r = *u1 * *u2;
+	if (mixed) {
+		T t = x.b * y.b;
+		if (t > r)
+			r = t;
+	}
+	return r;
+}
+
 template<typename T>
 Interval<T> IMul(const Interval<T> &x, const Interval<T> &y) {
 	Interval<T> r(0, 0);
-	T x1y1, x1y2, x2y1;
-
 	SetRounding<T>(FE_DOWNWARD);
-	x1y1 = x.a * y.a;
-	x1y2 = x.a * y.b;
-	x2y1 = x.b * y.a;
-	r.a = x.b * y.b;
-	if (x2y1 < r.a)
-		r.a = x2y1;
-	if (x1y2 < r.a)
-		r.a = x1y2;
-	if (x1y1 < r.a)
-		r.a = x1y1;
-
+	r.a = IMulLo(x, y);
 	SetRounding<T>(FE_UPWARD);
-	x1y1 = x.a * y.a;
-	x1y2 = x.a * y.b;
-	x2y1 = x.b * y.a;
-
-	r.b = x.b * y.b;
-	if (x2y1 > r.b)
-		r.b = x2y1;
-	if (x1y2 > r.b)
-		r.b = x1y2;
-	if (x1y1 > r.b)
-		r.b = x1y1;
+	r.b = IMulHi(x, y);
 	SetRounding<T>(FE_TONEAREST);
 	return r;
 }
 
+// Interval<mpreal>: each end with its own mpfr rounding (MPFR ignores
+// the FPU mode)
+inline mpreal IMulEnd(const Interval<mpreal> &x, const Interval<mpreal> &y,
+		mpfr_rnd_t rnd) {
+	const mpreal *l1, *l2, *u1, *u2;
+	const bool mixed = IMulCase(x, y, l1, l2, u1, u2);
+	const bool lower = (rnd == MPFR_RNDD);
+	mpreal r, t;
+	if (lower)
+		mpfr_mul(r.mpfr_ptr(), l1->mpfr_srcptr(), l2->mpfr_srcptr(), rnd);
+	else
+		mpfr_mul(r.mpfr_ptr(), u1->mpfr_srcptr(), u2->mpfr_srcptr(), rnd);
+	if (mixed) {
+		mpfr_mul(t.mpfr_ptr(), x.b.mpfr_srcptr(),
+				(lower ? y.a : y.b).mpfr_srcptr(), rnd);
+		if (lower ? t < r : t > r)
+			swap(r, t);
+	}
+	return r;
+}
+
+template<>
+inline Interval<mpreal> IMul(const Interval<mpreal> &x,
+		const Interval<mpreal> &y) {
+	Interval<mpreal> r;
+	r.a = IMulEnd(x, y, MPFR_RNDD);
+	r.b = IMulEnd(x, y, MPFR_RNDU);
+	return r;
+}
+
+// Sign classification of x/y for 0 not in y: (l1, l2) are the dividend
+// and divisor of the lower end, (u1, u2) of the upper end.
+template<typename T>
+inline void IDivCase(const Interval<T> &x, const Interval<T> &y, const T *&l1,
+		const T *&l2, const T *&u1, const T *&u2) {
+	if ((y.a <= 0) && (y.b >= 0))
+		throw runtime_error("Division by an interval containing 0.");
+	if (y.a > 0) {
+		if (x.a >= 0) {
+			l1 = &x.a; l2 = &y.b; u1 = &x.b; u2 = &y.a;
+		} else if (x.b <= 0) {
+			l1 = &x.a; l2 = &y.a; u1 = &x.b; u2 = &y.b;
+		} else {
+			l1 = &x.a; l2 = &y.a; u1 = &x.b; u2 = &y.a;
+		}
+	} else {
+		if (x.a >= 0) {
+			l1 = &x.b; l2 = &y.b; u1 = &x.a; u2 = &y.a;
+		} else if (x.b <= 0) {
+			l1 = &x.b; l2 = &y.a; u1 = &x.a; u2 = &y.b;
+		} else {
+			l1 = &x.b; l2 = &y.b; u1 = &x.a; u2 = &y.b;
+		}
+	}
+}
+
 template<typename T>
 Interval<T> IDiv(const Interval<T> &x, const Interval<T> &y) {
 	Interval<T> r;
-	T x1y1, x1y2, x2y1, t;
+	const T *l1, *l2, *u1, *u2;
+	IDivCase(x, y, l1, l2, u1, u2);
+	SetRounding<T>(FE_DOWNWARD);
+	r.a = *l1 / *l2;
+	SetRounding<T>(FE_UPWARD);
+	r.b = *u1 / *u2;
+	SetRounding<T>(FE_TONEAREST);
+	return r;
+}
 
-	if ((y.a <= 0) && (y.b >= 0)) {
-		throw runtime_error("Division by an interval containing 0.");
-	} else {
-		SetRounding<T>(FE_DOWNWARD);
-		x1y1 = x.a / y.a;
-		x1y2 = x.a / y.b;
-		x2y1 = x.b / y.a;
-		r.a = x.b / y.b;
-		t = r.a;
-		if (x2y1 < t)
-			r.a = x2y1;
-		if (x1y2 < t)
-			r.a = x1y2;
-		if (x1y1 < t)
-			r.a = x1y1;
+template<>
+inline Interval<mpreal> IDiv(const Interval<mpreal> &x,
+		const Interval<mpreal> &y) {
+	Interval<mpreal> r;
+	const mpreal *l1, *l2, *u1, *u2;
+	IDivCase(x, y, l1, l2, u1, u2);
+	mpfr_div(r.a.mpfr_ptr(), l1->mpfr_srcptr(), l2->mpfr_srcptr(), MPFR_RNDD);
+	mpfr_div(r.b.mpfr_ptr(), u1->mpfr_srcptr(), u2->mpfr_srcptr(), MPFR_RNDU);
+	return r;
+}
 
-		SetRounding<T>(FE_UPWARD);
-		x1y1 = x.a / y.a;
-		x1y2 = x.a / y.b;
-		x2y1 = x.b / y.a;
-
-		r.b = x.b / y.b;
-		t = r.b;
-		if (x2y1 > t)
-			r.b = x2y1;
-		if (x1y2 > t)
-			r.b = x1y2;
-		if (x1y1 > t)
-			r.b = x1y1;
+//-------------------------------------------------------------------------------------
+// Vector kernels over arrays of proper intervals (PINT mode).
+// The rounding mode is switched once per sweep instead of three times per
+// element: all lower ends are computed under FE_DOWNWARD, then all upper
+// ends under FE_UPWARD.  Lower ends go to a scratch buffer first, so r may
+// alias x or y.  Interval<mpreal> is specialised below on mpfr calls with
+// an explicit rounding direction (MPFR ignores the FPU mode).
 
-	}
+template<typename T>
+void IVAdd(int n, const Interval<T> *x, const Interval<T> *y, Interval<T> *r) {
+	std::vector<T> lo(n);
+	SetRounding<T>(FE_DOWNWARD);
+	for (int i = 0; i < n; ++i)
+		lo[i] = x[i].a + y[i].a;
+	SetRounding<T>(FE_UPWARD);
+	for (int i = 0; i < n; ++i)
+		r[i].b = x[i].b + y[i].b;
+	SetRounding<T>(FE_TONEAREST);
+	for (int i = 0; i < n; ++i)
+		r[i].a = lo[i];
+}
+
+template<typename T>
+void IVSub(int n, const Interval<T> *x, const Interval<T> *y, Interval<T> *r) {
+	std::vector<T> lo(n);
+	SetRounding<T>(FE_DOWNWARD);
+	for (int i = 0; i < n; ++i)
+		lo[i] = x[i].a - y[i].b;
+	SetRounding<T>(FE_UPWARD);
+	for (int i = 0; i < n; ++i)
+		r[i].b = x[i].b - y[i].a;
+	SetRounding<T>(FE_TONEAREST);
+	for (int i = 0; i < n; ++i)
+		r[i].a = lo[i];
+}
+
+template<typename T>
+void IVMul(int n, const Interval<T> *x, const Interval<T> *y, Interval<T> *r) {
+	std::vector<T> lo(n);
+	SetRounding<T>(FE_DOWNWARD);
+	for (int i = 0; i < n; ++i)
+		lo[i] = IMulLo(x[i], y[i]);
+	SetRounding<T>(FE_UPWARD);
+	for (int i = 0; i < n; ++i)
+		r[i].b = IMulHi(x[i], y[i]);
+	SetRounding<T>(FE_TONEAREST);
+	for (int i = 0; i < n; ++i)
+		r[i].a = lo[i];
+}
+
+// sum of x[i]*y[i]
+template<typename T>
+Interval<T> IVDot(int n, const Interval<T> *x, const Interval<T> *y) {
+	Interval<T> r(0, 0);
+	SetRounding<T>(FE_DOWNWARD);
+	for (int i = 0; i < n; ++i)
+		r.a = r.a + IMulLo(x[i], y[i]);
+	SetRounding<T>(FE_UPWARD);
+	for (int i = 0; i < n; ++i)
+		r.b = r.b + IMulHi(x[i], y[i]);
 	SetRounding<T>(FE_TONEAREST);
 	return r;
 }
 
+// y := y + alpha*x
+template<typename T>
+void IVAxpy(int n, const Interval<T> &alpha, const Interval<T> *x,
+		Interval<T> *y) {
+	const Interval<T> s = alpha;
+	std::vector<T> lo(n);
+	SetRounding<T>(FE_DOWNWARD);
+	for (int i = 0; i < n; ++i)
+		lo[i] = y[i].a + IMulLo(s, x[i]);
+	SetRounding<T>(FE_UPWARD);
+	for (int i = 0; i < n; ++i)
+		y[i].b = y[i].b + IMulHi(s, x[i]);
+	SetRounding<T>(FE_TONEAREST);
+	for (int i = 0; i < n; ++i)
+		y[i].a = lo[i];
+}
+
+// Interval<mpreal>: one pass, each end with its own mpfr rounding
+template<>
+inline void IVAdd(int n, const Interval<mpreal> *x, const Interval<mpreal> *y,
+		Interval<mpreal> *r) {
+	mpreal lo;
+	for (int i = 0; i < n; ++i) {
+		mpfr_add(lo.mpfr_ptr(), x[i].a.mpfr_srcptr(), y[i].a.mpfr_srcptr(),
+				MPFR_RNDD);
+		mpfr_add(r[i].b.mpfr_ptr(), x[i].b.mpfr_srcptr(), y[i].b.mpfr_srcptr(),
+				MPFR_RNDU);
+		swap(r[i].a, lo);
+	}
+}
+
+template<>
+inline void IVSub(int n, const Interval<mpreal> *x, const Interval<mpreal> *y,
+		Interval<mpreal> *r) {
+	mpreal lo, hi;
+	for (int i = 0; i < n; ++i) {
+		mpfr_sub(lo.mpfr_ptr(), x[i].a.mpfr_srcptr(), y[i].b.mpfr_srcptr(),
+				MPFR_RNDD);
+		mpfr_sub(hi.mpfr_ptr(), x[i].b.mpfr_srcptr(), y[i].a.mpfr_srcptr(),
+				MPFR_RNDU);
+		swap(r[i].a, lo);
+		swap(r[i].b, hi);
+	}
+}
+
+template<>
+inline void IVMul(int n, const Interval<mpreal> *x, const Interval<mpreal> *y,
+		Interval<mpreal> *r) {
+	for (int i = 0; i < n; ++i) {
+		mpreal lo = IMulEnd(x[i], y[i], MPFR_RNDD);
+		mpreal hi = IMulEnd(x[i], y[i], MPFR_RNDU);
+		swap(r[i].a, lo);
+		swap(r[i].b, hi);
+	}
+}
+
+template<>
+inline Interval<mpreal> IVDot(int n, const Interval<mpreal> *x,
+		const Interval<mpreal> *y) {
+	Interval<mpreal> r(0, 0);
+	for (int i = 0; i < n; ++i) {
+		mpfr_add(r.a.mpfr_ptr(), r.a.mpfr_srcptr(),
+				IMulEnd(x[i], y[i], MPFR_RNDD).mpfr_srcptr(), MPFR_RNDD);
+		mpfr_add(r.b.mpfr_ptr(), r.b.mpfr_srcptr(),
+				IMulEnd(x[i], y[i], MPFR_RNDU).mpfr_srcptr(), MPFR_RNDU);
+	}
+	return r;
+}
+
+template<>
+inline void IVAxpy(int n, const Interval<mpreal> &alpha,
+		const Interval<mpreal> *x, Interval<mpreal> *y) {
+	const Interval<mpreal> s = alpha;
+	for (int i = 0; i < n; ++i) {
+		mpreal lo = IMulEnd(s, x[i], MPFR_RNDD);
+		mpreal hi = IMulEnd(s, x[i], MPFR_RNDU);
+		mpfr_add(y[i].a.mpfr_ptr(), y[i].a.mpfr_srcptr(), lo.mpfr_srcptr(),
+				MPFR_RNDD);
+		mpfr_add(y[i].b.mpfr_ptr(), y[i].b.mpfr_srcptr(), hi.mpfr_srcptr(),
+				MPFR_RNDU);
+	}
+}
+
 template<typename T>
 Interval<T> DIAdd(const Interval<T> &x, const Interval<T> &y) {
 	Interval<T> z1, z2;
@@ -1658,6 +1871,18 @@ template class Interval<double> ;
 template class Interval<float> ;
 template class Interval<mpreal> ;
 
+// No vtable and defaulted copies: for hardware types an interval is just
+// its two ends, so arrays of them can be memcpy'd and fed to SIMD kernels.
+static_assert(std::is_trivially_copyable<Interval<double> >::value
+		&& sizeof(Interval<double>) == 2 * sizeof(double),
+		"Interval<double> must be a plain pair of ends");
+static_assert(std::is_trivially_copyable<Interval<float> >::value
+		&& sizeof(Interval<float>) == 2 * sizeof(float),
+		"Interval<float> must be a plain pair of ends");
+static_assert(std::is_trivially_copyable<Interval<long double> >::value
+		&& sizeof(Interval<long double>) == 2 * sizeof(long double),
+		"Interval<long double> must be a plain pair of ends");
+
 template<typename T> IAMode Interval<T>::mode = PINT_MODE;
 template<typename T> IAOutDigits Interval<T>::outdigits = LONGDOUBLE_DIGITS;
 
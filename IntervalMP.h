@@ -0,0 +1,115 @@
+#pragma once
+/* ============================================================
+ *  IntervalMP.h  – przedział boost::interval na mpreal
+ *
+ *  Zaokrąglanie końców przez MPFR: każde działanie woła
+ *  mpfr_* z jawnym MPFR_RNDD (dolny koniec) / MPFR_RNDU
+ *  (górny).  Poprzednia polityka (save_state<rounded_transc_
+ *  std>) przełączała tryb FPU przy każdym działaniu, a MPFR
+ *  i tak go nie czyta – końce liczone operatorami mpreal szły
+ *  w domyślnym RNDN, więc otoczka nie była zewnętrzna.
+ *
+ *  Polityka nie ma stanu: init() i konstruktor są puste,
+ *  nic globalnego nie jest przełączane.  Precyzja wyniku –
+ *  większa z precyzji argumentów, jak w operatorach mpreal.
+ * ============================================================ */
+#include "mpreal.h"
+#include <algorithm>
+#include <type_traits>
+#include <boost/numeric/interval.hpp>
+#include <boost/numeric/interval/policies.hpp>
+
+namespace interval_mp {
+
+using mpfr::mpreal;
+
+struct MpfrRounding
+{
+    using unprotected_rounding = MpfrRounding;      // nie ma czego chronić
+
+    void init() { }
+
+    /* --- konwersje -------------------------------------------------------- */
+    template<class U> mpreal conv_down(const U& v) { return conv(v, MPFR_RNDD); }
+    template<class U> mpreal conv_up  (const U& v) { return conv(v, MPFR_RNDU); }
+
+    /* --- arytmetyka --------------------------------------------------------- */
+    mpreal add_down(const mpreal& x, const mpreal& y) { return op(mpfr_add, x, y, MPFR_RNDD); }
+    mpreal add_up  (const mpreal& x, const mpreal& y) { return op(mpfr_add, x, y, MPFR_RNDU); }
+    mpreal sub_down(const mpreal& x, const mpreal& y) { return op(mpfr_sub, x, y, MPFR_RNDD); }
+    mpreal sub_up  (const mpreal& x, const mpreal& y) { return op(mpfr_sub, x, y, MPFR_RNDU); }
+    mpreal mul_down(const mpreal& x, const mpreal& y) { return op(mpfr_mul, x, y, MPFR_RNDD); }
+    mpreal mul_up  (const mpreal& x, const mpreal& y) { return op(mpfr_mul, x, y, MPFR_RNDU); }
+    mpreal div_down(const mpreal& x, const mpreal& y) { return op(mpfr_div, x, y, MPFR_RNDD); }
+    mpreal div_up  (const mpreal& x, const mpreal& y) { return op(mpfr_div, x, y, MPFR_RNDU); }
+
+    mpreal median(const mpreal& x, const mpreal& y)
+    {
+        mpreal r = op(mpfr_add, x, y, MPFR_RNDN);
+        mpfr_div_2ui(r.mpfr_ptr(), r.mpfr_srcptr(), 1, MPFR_RNDN);     // dokładne
+        return r;
+    }
+
+    mpreal sqrt_down(const mpreal& x) { return fn(mpfr_sqrt, x, MPFR_RNDD); }
+    mpreal sqrt_up  (const mpreal& x) { return fn(mpfr_sqrt, x, MPFR_RNDU); }
+
+    mpreal int_down(const mpreal& x)
+    {
+        mpreal r(0, x.getPrecision());
+        mpfr_floor(r.mpfr_ptr(), x.mpfr_srcptr());
+        return r;
+    }
+    mpreal int_up(const mpreal& x)
+    {
+        mpreal r(0, x.getPrecision());
+        mpfr_ceil(r.mpfr_ptr(), x.mpfr_srcptr());
+        return r;
+    }
+
+    /* --- funkcje przestępne (jak w rounded_transc_std) -------------------- */
+#define INTERVAL_MP_TRANSC(f)                                                  \
+    mpreal f##_down(const mpreal& x) { return fn(mpfr_##f, x, MPFR_RNDD); }    \
+    mpreal f##_up  (const mpreal& x) { return fn(mpfr_##f, x, MPFR_RNDU); }
+    INTERVAL_MP_TRANSC(exp)   INTERVAL_MP_TRANSC(log)
+    INTERVAL_MP_TRANSC(sin)   INTERVAL_MP_TRANSC(cos)   INTERVAL_MP_TRANSC(tan)
+    INTERVAL_MP_TRANSC(asin)  INTERVAL_MP_TRANSC(acos)  INTERVAL_MP_TRANSC(atan)
+    INTERVAL_MP_TRANSC(sinh)  INTERVAL_MP_TRANSC(cosh)  INTERVAL_MP_TRANSC(tanh)
+    INTERVAL_MP_TRANSC(asinh) INTERVAL_MP_TRANSC(acosh) INTERVAL_MP_TRANSC(atanh)
+#undef INTERVAL_MP_TRANSC
+
+private:
+    using Binary = int (*)(mpfr_ptr, mpfr_srcptr, mpfr_srcptr, mpfr_rnd_t);
+    using Unary  = int (*)(mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
+
+    static mpreal op(Binary f, const mpreal& x, const mpreal& y, mpfr_rnd_t rnd)
+    {
+        mpreal r(0, std::max(x.getPrecision(), y.getPrecision()));
+        f(r.mpfr_ptr(), x.mpfr_srcptr(), y.mpfr_srcptr(), rnd);
+        return r;
+    }
+
+    static mpreal fn(Unary f, const mpreal& x, mpfr_rnd_t rnd)
+    {
+        mpreal r(0, x.getPrecision());
+        f(r.mpfr_ptr(), x.mpfr_srcptr(), rnd);
+        return r;
+    }
+
+    template<class U>
+    static mpreal conv(const U& v, mpfr_rnd_t rnd)
+    {
+        if constexpr (std::is_same_v<U, mpreal>) return v;          // bez zmian
+        else                                     return mpreal(v, mpreal::get_default_prec(), rnd);
+    }
+};
+
+} // namespace interval_mp
+
+/* --- przedział mp-real --------------------------------------------------- */
+using IntervalMP = boost::numeric::interval<
+    mpfr::mpreal,
+    boost::numeric::interval_lib::policies<
+        interval_mp::MpfrRounding,
+        boost::numeric::interval_lib::checking_no_nan<mpfr::mpreal>
+    >
+>;
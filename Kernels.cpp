@@ -0,0 +1,322 @@
+/* ===========================================================
+ *  Kernels.cpp  – jądra double: skalarne, AVX2, AVX-512
+ * ========================================================= */
+#include "Kernels.h"
+#include <cstddef>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define KERNELS_X86 1
+#include <immintrin.h>
+/* axpy ma dawać to samo co wersja skalarna – bez ściągania
+   mnożenia i dodawania do FMA */
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+namespace kernels {
+namespace {
+
+/* ---------- wersja skalarna (odniesienie) ----------------- */
+double dotScalar(int n, const double* x, const double* y, double s)
+{
+    for (int k = 0; k < n; ++k) s += x[k]*y[k];
+    return s;
+}
+
+void axpyScalar(int n, double a, const double* x, double* y)
+{
+    for (int k = 0; k < n; ++k) y[k] += a*x[k];
+}
+
+#ifdef KERNELS_X86
+/* ---------- AVX2 + FMA ------------------------------------ */
+__attribute__((target("avx2,fma")))
+double dotAvx2(int n, const double* x, const double* y, double s)
+{
+    __m256d a0 = _mm256_setzero_pd(), a1 = _mm256_setzero_pd();
+    int k = 0;
+    for (; k + 8 <= n; k += 8) {
+        a0 = _mm256_fmadd_pd(_mm256_loadu_pd(x + k),     _mm256_loadu_pd(y + k),     a0);
+        a1 = _mm256_fmadd_pd(_mm256_loadu_pd(x + k + 4), _mm256_loadu_pd(y + k + 4), a1);
+    }
+    if (k + 4 <= n) {
+        a0 = _mm256_fmadd_pd(_mm256_loadu_pd(x + k), _mm256_loadu_pd(y + k), a0);
+        k += 4;
+    }
+    a0 = _mm256_add_pd(a0, a1);
+    __m128d h = _mm_add_pd(_mm256_castpd256_pd128(a0), _mm256_extractf128_pd(a0, 1));
+    double r = _mm_cvtsd_f64(_mm_add_sd(h, _mm_unpackhi_pd(h, h)));
+    for (; k < n; ++k) r += x[k]*y[k];
+    return s + r;
+}
+
+__attribute__((target("avx2")))
+void axpyAvx2(int n, double a, const double* x, double* y)
+{
+    const __m256d va = _mm256_set1_pd(a);
+    int k = 0;
+    for (; k + 4 <= n; k += 4)
+        _mm256_storeu_pd(y + k, _mm256_add_pd(_mm256_loadu_pd(y + k),
+                                              _mm256_mul_pd(va, _mm256_loadu_pd(x + k))));
+    for (; k < n; ++k) y[k] += a*x[k];
+}
+
+/* ---------- AVX-512F -------------------------------------- */
+__attribute__((target("avx512f")))
+double dotAvx512(int n, const double* x, const double* y, double s)
+{
+    __m512d a0 = _mm512_setzero_pd(), a1 = _mm512_setzero_pd();
+    int k = 0;
+    for (; k + 16 <= n; k += 16) {
+        a0 = _mm512_fmadd_pd(_mm512_loadu_pd(x + k),     _mm512_loadu_pd(y + k),     a0);
+        a1 = _mm512_fmadd_pd(_mm512_loadu_pd(x + k + 8), _mm512_loadu_pd(y + k + 8), a1);
+    }
+    if (k + 8 <= n) {
+        a0 = _mm512_fmadd_pd(_mm512_loadu_pd(x + k), _mm512_loadu_pd(y + k), a0);
+        k += 8;
+    }
+    if (k < n) {                                        // ogon maską
+        const __mmask8 m = static_cast<__mmask8>((1u << (n - k)) - 1);
+        a1 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(m, x + k),
+                             _mm512_maskz_loadu_pd(m, y + k), a1);
+    }
+    alignas(64) double t[8];
+    _mm512_store_pd(t, _mm512_add_pd(a0, a1));
+    return s + (((t[0] + t[1]) + (t[2] + t[3])) + ((t[4] + t[5]) + (t[6] + t[7])));
+}
+
+__attribute__((target("avx512f")))
+void axpyAvx512(int n, double a, const double* x, double* y)
+{
+    const __m512d va = _mm512_set1_pd(a);
+    int k = 0;
+    for (; k + 8 <= n; k += 8)
+        _mm512_storeu_pd(y + k, _mm512_add_pd(_mm512_loadu_pd(y + k),
+                                              _mm512_mul_pd(va, _mm512_loadu_pd(x + k))));
+    if (k < n) {
+        const __mmask8 m = static_cast<__mmask8>((1u << (n - k)) - 1);
+        __m512d vy = _mm512_maskz_loadu_pd(m, y + k);
+        vy = _mm512_add_pd(vy, _mm512_mul_pd(va, _mm512_maskz_loadu_pd(m, x + k)));
+        _mm512_mask_storeu_pd(y + k, m, vy);
+    }
+}
+
+/* ---------- partia trójdiagonalna: układ na linię ---------
+   Grupa W sąsiednich układów idzie jednym wektorem.  Linia ze
+   złym pivotem liczy dalej bez rozgałęzień (wynik i tak jest
+   potem zerowany); st dostaje krok pierwszego złego pivota.  */
+constexpr double tridiagEps = 1e-20;                // jak w Solverze
+
+inline void markFailed(unsigned bad, unsigned& failed, int step, int* st)
+{
+    bad &= ~failed;
+    failed |= bad;
+    for (int w = 0; bad; ++w, bad >>= 1)
+        if (bad & 1u) st[w] = step;
+}
+
+inline void zeroFailed(unsigned failed, int w, int n, int batch, double* b)
+{
+    for (int k = 0; k < w; ++k)
+        if (failed >> k & 1u)
+            for (int i = 0; i < n; ++i) b[std::size_t(i) * batch + k] = 0.0;
+}
+
+/* maska linii z |l| < eps */
+__attribute__((target("avx2")))
+inline unsigned smallAvx2(__m256d l)
+{
+    const __m256d a = _mm256_andnot_pd(_mm256_set1_pd(-0.0), l);
+    return unsigned(_mm256_movemask_pd(
+        _mm256_cmp_pd(a, _mm256_set1_pd(tridiagEps), _CMP_LT_OQ)));
+}
+
+__attribute__((target("avx512f")))
+inline unsigned smallAvx512(__m512d l)
+{
+    return _mm512_cmp_pd_mask(_mm512_abs_pd(l), _mm512_set1_pd(tridiagEps), _CMP_LT_OQ);
+}
+
+__attribute__((target("avx2")))
+int tridiagAvx2(int n, int batch, const double* sub, const double* diag,
+                double* sup, double* b, int* st)
+{
+    if (n <= 0) return 0;
+    int s = 0;
+    for (; s + 4 <= batch; s += 4)
+    {
+        for (int w = 0; w < 4; ++w) st[s + w] = 0;
+        unsigned failed = 0;
+
+        __m256d l = _mm256_loadu_pd(diag + s), u = _mm256_setzero_pd(), x;
+        markFailed(smallAvx2(l), failed, 1, st + s);
+        if (n > 1) _mm256_storeu_pd(sup + s, u = _mm256_div_pd(_mm256_loadu_pd(sup + s), l));
+        _mm256_storeu_pd(b + s, x = _mm256_div_pd(_mm256_loadu_pd(b + s), l));
+
+        for (int i = 1; i < n; ++i)
+        {
+            const std::size_t o = std::size_t(i) * batch + s, p = o - batch;
+            const __m256d c = _mm256_loadu_pd(sub + p);
+            l = _mm256_sub_pd(_mm256_loadu_pd(diag + o), _mm256_mul_pd(c, u));
+            if (unsigned bad = smallAvx2(l)) markFailed(bad, failed, i + 1, st + s);
+
+            if (i < n-1) _mm256_storeu_pd(sup + o, u = _mm256_div_pd(_mm256_loadu_pd(sup + o), l));
+            x = _mm256_div_pd(_mm256_sub_pd(_mm256_loadu_pd(b + o), _mm256_mul_pd(c, x)), l);
+            _mm256_storeu_pd(b + o, x);
+        }
+
+        for (int i = n - 2; i >= 0; --i)                // Ux = y
+        {
+            const std::size_t o = std::size_t(i) * batch + s;
+            x = _mm256_sub_pd(_mm256_loadu_pd(b + o), _mm256_mul_pd(_mm256_loadu_pd(sup + o), x));
+            _mm256_storeu_pd(b + o, x);
+        }
+        if (failed) zeroFailed(failed, 4, n, batch, b + s);
+    }
+    return s;
+}
+
+__attribute__((target("avx512f")))
+int tridiagAvx512(int n, int batch, const double* sub, const double* diag,
+                  double* sup, double* b, int* st)
+{
+    if (n <= 0) return 0;
+    int s = 0;
+    for (; s + 8 <= batch; s += 8)
+    {
+        for (int w = 0; w < 8; ++w) st[s + w] = 0;
+        unsigned failed = 0;
+
+        __m512d l = _mm512_loadu_pd(diag + s), u = _mm512_setzero_pd(), x;
+        markFailed(smallAvx512(l), failed, 1, st + s);
+        if (n > 1) _mm512_storeu_pd(sup + s, u = _mm512_div_pd(_mm512_loadu_pd(sup + s), l));
+        _mm512_storeu_pd(b + s, x = _mm512_div_pd(_mm512_loadu_pd(b + s), l));
+
+        for (int i = 1; i < n; ++i)
+        {
+            const std::size_t o = std::size_t(i) * batch + s, p = o - batch;
+            const __m512d c = _mm512_loadu_pd(sub + p);
+            l = _mm512_sub_pd(_mm512_loadu_pd(diag + o), _mm512_mul_pd(c, u));
+            if (unsigned bad = smallAvx512(l)) markFailed(bad, failed, i + 1, st + s);
+
+            if (i < n-1) _mm512_storeu_pd(sup + o, u = _mm512_div_pd(_mm512_loadu_pd(sup + o), l));
+            x = _mm512_div_pd(_mm512_sub_pd(_mm512_loadu_pd(b + o), _mm512_mul_pd(c, x)), l);
+            _mm512_storeu_pd(b + o, x);
+        }
+
+        for (int i = n - 2; i >= 0; --i)                // Ux = y
+        {
+            const std::size_t o = std::size_t(i) * batch + s;
+            x = _mm512_sub_pd(_mm512_loadu_pd(b + o), _mm512_mul_pd(_mm512_loadu_pd(sup + o), x));
+            _mm512_storeu_pd(b + o, x);
+        }
+        if (failed) zeroFailed(failed, 8, n, batch, b + s);
+    }
+    return s;
+}
+#endif
+
+int tridiagScalar(int, int, const double*, const double*, double*, double*, int*)
+{
+    return 0;
+}
+
+/* ---------- tablica skoków -------------------------------- */
+struct Table
+{
+    Isa isa;
+    double (*dot)(int, const double*, const double*, double);
+    void   (*axpy)(int, double, const double*, double*);
+    int    (*tridiag)(int, int, const double*, const double*, double*, double*, int*);
+};
+
+Table tableFor(Isa isa)
+{
+#ifdef KERNELS_X86
+    if (isa == Isa::AVX512) return { Isa::AVX512, dotAvx512, axpyAvx512, tridiagAvx512 };
+    if (isa == Isa::AVX2)   return { Isa::AVX2,   dotAvx2,   axpyAvx2,   tridiagAvx2   };
+#endif
+    return { Isa::Scalar, dotScalar, axpyScalar, tridiagScalar };
+}
+
+Isa detect()
+{
+#ifdef KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+        return Isa::AVX512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        return Isa::AVX2;
+#endif
+    return Isa::Scalar;
+}
+
+const Isa detected = detect();
+Table     active   = tableFor(detected);
+
+} // namespace
+
+Isa detectedIsa() { return detected; }
+Isa activeIsa()   { return active.isa; }
+
+void setIsa(Isa isa)
+{
+    if (static_cast<int>(isa) > static_cast<int>(detected)) isa = detected;
+    active = tableFor(isa);
+}
+
+const char* isaName(Isa isa)
+{
+    switch (isa) {
+    case Isa::AVX512: return "AVX-512";
+    case Isa::AVX2:   return "AVX2";
+    default:          return "skalarne";
+    }
+}
+
+double dot(int n, const double* x, const double* y, double s)
+{
+    return active.dot(n, x, y, s);
+}
+
+void axpy(int n, double a, const double* x, double* y)
+{
+    active.axpy(n, a, x, y);
+}
+
+/* ---------- mpreal ---------------------------------------- */
+
+/* s - x·y = -(x·y - s):  mpfr_fms i zmiana znaku (dokładna),
+   z odwróconym kierunkiem zaokrąglenia */
+void mulSub(mpfr::mpreal& s, const mpfr::mpreal& x, const mpfr::mpreal& y)
+{
+    mpfr_rnd_t rnd = mpfr::mpreal::get_default_rnd();
+    if      (rnd == MPFR_RNDU) rnd = MPFR_RNDD;
+    else if (rnd == MPFR_RNDD) rnd = MPFR_RNDU;
+    mpfr_fms(s.mpfr_ptr(), x.mpfr_srcptr(), y.mpfr_srcptr(), s.mpfr_srcptr(), rnd);
+    mpfr_neg(s.mpfr_ptr(), s.mpfr_srcptr(), MPFR_RNDN);
+}
+
+mpfr::mpreal dot(int n, const mpfr::mpreal* x, const mpfr::mpreal* y, mpfr::mpreal s)
+{
+    const mpfr_rnd_t rnd = mpfr::mpreal::get_default_rnd();
+    for (int k = 0; k < n; ++k)
+        mpfr_fma(s.mpfr_ptr(), x[k].mpfr_srcptr(), y[k].mpfr_srcptr(),
+                 s.mpfr_srcptr(), rnd);
+    return s;
+}
+
+void axpy(int n, const mpfr::mpreal& a, const mpfr::mpreal* x, mpfr::mpreal* y)
+{
+    const mpfr_rnd_t rnd = mpfr::mpreal::get_default_rnd();
+    for (int k = 0; k < n; ++k)
+        mpfr_fma(y[k].mpfr_ptr(), a.mpfr_srcptr(), x[k].mpfr_srcptr(),
+                 y[k].mpfr_srcptr(), rnd);
+}
+
+int tridiagBatch(int n, int batch, const double* sub, const double* diag,
+                 double* sup, double* b, int* st)
+{
+    return active.tridiag(n, batch, sub, diag, sup, b, st);
+}
+
+} // namespace kernels
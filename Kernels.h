@@ -0,0 +1,84 @@
+#pragma once
+/* ============================================================
+ *  Kernels.h  – jądra iloczynu skalarnego i axpy
+ *
+ *  Wersje szablonowe liczą dokładnie tak, jak pętle Solvera
+ *  (s += x[k]*y[k], k rosnąco).  Dla double są przeciążenia
+ *  z jądrami AVX2 / AVX-512 wybieranymi w czasie działania
+ *  (CPUID), z zapasową wersją skalarną.
+ *
+ *  axpy w SIMD to osobne mnożenie i dodawanie – wynik jest
+ *  identyczny ze skalarnym.  dot w SIMD sumuje w innej
+ *  kolejności (kilka akumulatorów, FMA); różnica względem
+ *  wersji skalarnej mieści się w standardowym oszacowaniu
+ *      |dot_simd - dot_scalar| ≤ 2·γ_n · Σ|x_k·y_k|,
+ *      γ_n = n·u / (1 - n·u),  u = 2⁻⁵³.
+ *
+ *  Dla mpreal s += x*y tworzy obiekt tymczasowy (alokację
+ *  mpfr) na każdy iloczyn.  Przeciążenia mpreal liczą w miejscu
+ *  przez mpfr_fma: jedno poprawne zaokrąglenie na krok
+ *  (s ← ∘(s + x·y)) zamiast dwóch, bez alokacji w pętli.
+ * ============================================================ */
+#include "mpreal.h"
+
+namespace kernels {
+
+enum class Isa { Scalar, AVX2, AVX512 };
+
+Isa  detectedIsa();             // co obsługuje procesor
+Isa  activeIsa();               // co jest aktualnie używane
+void setIsa(Isa isa);           // wymuszenie (nie ponad detectedIsa())
+const char* isaName(Isa isa);
+
+/* --- s + Σ x[k]·y[k] ------------------------------------------------- */
+template<typename T>
+inline T dot(int n, const T* x, const T* y, T s = T(0))
+{
+    for (int k = 0; k < n; ++k) s += x[k]*y[k];
+    return s;
+}
+
+/* --- y[k] += a·x[k] -------------------------------------------------- */
+template<typename T>
+inline void axpy(int n, const T& a, const T* x, T* y)
+{
+    for (int k = 0; k < n; ++k) y[k] += a*x[k];
+}
+
+/* --- s += x·y,  s -= x·y  (pętle z krokiem ≠ 1) ---------------------- */
+template<typename T>
+inline void mulAdd(T& s, const T& x, const T& y) { s += x*y; }
+
+template<typename T>
+inline void mulSub(T& s, const T& x, const T& y) { s -= x*y; }
+
+/* --- mpreal: mpfr_fma / mpfr_fms w miejscu ---------------------------- */
+inline void mulAdd(mpfr::mpreal& s, const mpfr::mpreal& x, const mpfr::mpreal& y)
+{
+    mpfr_fma(s.mpfr_ptr(), x.mpfr_srcptr(), y.mpfr_srcptr(), s.mpfr_srcptr(),
+             mpfr::mpreal::get_default_rnd());
+}
+
+void mulSub(mpfr::mpreal& s, const mpfr::mpreal& x, const mpfr::mpreal& y);
+
+mpfr::mpreal dot (int n, const mpfr::mpreal* x, const mpfr::mpreal* y,
+                  mpfr::mpreal s = mpfr::mpreal(0));
+void         axpy(int n, const mpfr::mpreal& a, const mpfr::mpreal* x,
+                  mpfr::mpreal* y);
+
+/* --- double: dispatch w czasie działania ----------------------------- */
+double dot (int n, const double* x, const double* y, double s = 0.0);
+void   axpy(int n, double a, const double* x, double* y);
+
+/* --- partia układów trójdiagonalnych, jeden układ na linię SIMD ------
+   Zapis przeplatany: element i układu s leży pod [i*batch + s].
+   Recurrencja Crouta jak w Solver::solveCroutTridiagonalInPlace
+   (te same działania, wynik bitowo ten sam), sup ← u, b ← x,
+   st[s] – status układu s (b układu z st ≠ 0 jest zerowane).
+   Obsługuje pełne grupy linii od początku; zwraca liczbę
+   obsłużonych układów (0 dla wersji skalarnej) – resztę liczy
+   wołający.                                                          */
+int tridiagBatch(int n, int batch, const double* sub, const double* diag,
+                 double* sup, double* b, int* st);
+
+} // namespace kernels
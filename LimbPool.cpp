@@ -0,0 +1,185 @@
+/* ===========================================================
+ *  LimbPool.cpp
+ *
+ *  Każdy blok ma 16-bajtowy nagłówek: znacznik i klasę
+ *  rozmiaru.  Zwolnienie nie ufa rozmiarowi podanemu przez
+ *  GMP (dla napisów bywa inny niż przy przydziale), a bloki
+ *  bez znacznika (sprzed installLimbPool) wracają do free().
+ * ========================================================= */
+#include "LimbPool.h"
+#include <gmp.h>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+namespace {
+
+constexpr std::size_t    Header  = 16;
+constexpr std::size_t    Grain   = 16;              // krok klas rozmiaru
+constexpr std::size_t    MaxSize = 1024;            // większe – malloc
+constexpr std::size_t    Classes = MaxSize / Grain;
+constexpr std::size_t    Chunk   = 64 * 1024;       // płyta
+constexpr std::uint64_t  Magic   = 0x4c696d62506f6f6cULL;
+constexpr std::uint64_t  Large   = std::uint64_t(1) << 63;    // | rozmiar
+
+struct Block { Block* next; };
+
+struct Tag { std::uint64_t magic, cls; };
+
+/* listy wątków, które się zakończyły (i przydziały po ich końcu) */
+struct Depot
+{
+    std::mutex m;
+    Block*     head[Classes] = {};
+};
+Depot& depot() { static Depot* d = new Depot; return *d; }   // żyje do końca
+
+std::atomic<std::size_t> slabBytes{0};
+std::atomic<bool>        installed{false};
+
+[[noreturn]] void outOfMemory()
+{
+    std::fputs("LimbPool: brak pamięci\n", stderr);
+    std::abort();
+}
+
+inline std::size_t classOf(std::size_t n)  { return (n + Grain - 1) / Grain - 1; }
+inline std::size_t blockSize(std::size_t c) { return Header + (c + 1) * Grain; }
+
+/* nowa płyta klasy c, bloki połączone w listę */
+Block* carve(std::size_t c)
+{
+    char* p = static_cast<char*>(std::malloc(Chunk));
+    if (!p) outOfMemory();
+    slabBytes += Chunk;
+
+    const std::size_t bs = blockSize(c), count = Chunk / bs;
+    for (std::size_t k = 0; k < count; ++k) {
+        Block* b = reinterpret_cast<Block*>(p + k*bs);
+        b->next  = k + 1 < count ? reinterpret_cast<Block*>(p + (k + 1)*bs) : nullptr;
+    }
+    return reinterpret_cast<Block*>(p);
+}
+
+struct Local
+{
+    Block* head[Classes] = {};
+
+    ~Local()                                        // oddaj do magazynu
+    {
+        Depot& d = depot();
+        std::lock_guard<std::mutex> lk(d.m);
+        for (std::size_t c = 0; c < Classes; ++c)
+            while (Block* b = head[c]) {
+                head[c] = b->next;
+                b->next = d.head[c];
+                d.head[c] = b;
+            }
+        dead() = true;
+    }
+
+    static bool& dead() { thread_local bool v = false; return v; }
+};
+thread_local Local local;
+
+Block* take(std::size_t c)
+{
+    if (!Local::dead()) {
+        Block*& h = local.head[c];
+        if (!h) {
+            Depot& d = depot();
+            {
+                std::lock_guard<std::mutex> lk(d.m);
+                h = d.head[c];
+                d.head[c] = nullptr;
+            }
+            if (!h) h = carve(c);
+        }
+        Block* b = h;
+        h = b->next;
+        return b;
+    }
+
+    Depot& d = depot();
+    std::lock_guard<std::mutex> lk(d.m);
+    if (!d.head[c]) d.head[c] = carve(c);
+    Block* b = d.head[c];
+    d.head[c] = b->next;
+    return b;
+}
+
+void give(Block* b, std::size_t c)
+{
+    if (!Local::dead()) {
+        b->next = local.head[c];
+        local.head[c] = b;
+        return;
+    }
+    Depot& d = depot();
+    std::lock_guard<std::mutex> lk(d.m);
+    b->next = d.head[c];
+    d.head[c] = b;
+}
+
+inline Tag* tagOf(void* p) { return reinterpret_cast<Tag*>(static_cast<char*>(p) - Header); }
+
+void* poolAlloc(std::size_t n)
+{
+    if (n > MaxSize) {
+        char* p = static_cast<char*>(std::malloc(Header + n));
+        if (!p) outOfMemory();
+        *reinterpret_cast<Tag*>(p) = { Magic, Large | n };
+        return p + Header;
+    }
+    const std::size_t c = classOf(n ? n : 1);
+    char* p = reinterpret_cast<char*>(take(c));
+    *reinterpret_cast<Tag*>(p) = { Magic, c };
+    return p + Header;
+}
+
+void poolFree(void* p, std::size_t)
+{
+    if (!p) return;
+    Tag* t = tagOf(p);
+    if (t->magic != Magic) { std::free(p); return; }        // sprzed instalacji
+    t->magic = 0;
+    if (t->cls & Large) std::free(t);
+    else                 give(reinterpret_cast<Block*>(t), std::size_t(t->cls));
+}
+
+void* poolRealloc(void* p, std::size_t oldSize, std::size_t n)
+{
+    if (!p) return poolAlloc(n);
+    const Tag* t = tagOf(p);
+    if (t->magic != Magic) {                                // sprzed instalacji
+        void* q = poolAlloc(n);
+        std::memcpy(q, p, oldSize < n ? oldSize : n);
+        std::free(p);
+        return q;
+    }
+    if (!(t->cls & Large) && n && n <= MaxSize && classOf(n) == t->cls)
+        return p;                                           // ta sama klasa
+
+    const std::size_t have = t->cls & Large ? std::size_t(t->cls & ~Large)
+                                            : (t->cls + 1) * Grain;
+    void* q = poolAlloc(n);
+    std::memcpy(q, p, have < n ? have : n);
+    poolFree(p, oldSize);
+    return q;
+}
+
+} // namespace
+
+void installLimbPool()
+{
+    bool expected = false;
+    if (installed.compare_exchange_strong(expected, true))
+        mp_set_memory_functions(poolAlloc, poolRealloc, poolFree);
+}
+
+bool limbPoolInstalled() { return installed; }
+
+std::size_t limbPoolBytes() { return slabBytes; }
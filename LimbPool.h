@@ -0,0 +1,29 @@
+#pragma once
+/* ============================================================
+ *  LimbPool.h  – pula pamięci na limby mpfr (mpreal)
+ *
+ *  Każdy mpreal to osobny blok limbów z malloc: macierz n×n
+ *  to n² wywołań mpfr_init2 + malloc przy budowie i tyle samo
+ *  free przy zwalnianiu, a każde  F[i][j] = a - b  alokuje
+ *  wynik tymczasowy i zwalnia stary blok.
+ *
+ *  installLimbPool() podpina pod GMP/MPFR własne funkcje
+ *  pamięci (mp_set_memory_functions).  Bloki do 1 KiB (limby
+ *  do ~8000 bitów precyzji) idą z płyt: ciągłych kawałków
+ *  64 KiB pokrojonych na bloki jednego rozmiaru, czyli jednej
+ *  precyzji.  Przydział i zwolnienie to zdjęcie / odłożenie
+ *  bloku z listy wątku – O(1), bez malloc i bez blokady.
+ *  Większe bloki idą zwykłym malloc.
+ *
+ *  Wołać raz, na początku main(), przed utworzeniem obiektów
+ *  mpreal (bloki zaalokowane wcześniej są rozpoznawane i przy
+ *  zwolnieniu wracają do free()).  Odpiąć się nie da: pula
+ *  żyje do końca programu.
+ * ============================================================ */
+#include <cstddef>
+
+void installLimbPool();
+bool limbPoolInstalled();
+
+/* pamięć trzymana w płytach (bajty) – do diagnostyki */
+std::size_t limbPoolBytes();
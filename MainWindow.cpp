@@ -9,19 +9,10 @@
 #include <iomanip>
 
 #include <mpreal.h>
-#include <boost/numeric/interval.hpp>
-#include <boost/numeric/interval/rounded_transc.hpp>
-#include <boost/numeric/interval/policies.hpp>
+#include "IntervalMP.h"
 
 using namespace interval_arithmetic;
 using namespace boost::numeric;
-using IntervalMP = interval<
-        mpfr::mpreal,
-        interval_lib::policies<
-            interval_lib::save_state<interval_lib::rounded_transc_std<mpfr::mpreal>>,
-            interval_lib::checking_no_nan<mpfr::mpreal>
-        >
->;
 
 static std::string prettifyExp(std::string s)
 {
@@ -48,25 +39,121 @@ MainWindow::MainWindow(QWidget *parent) : QWidget(parent)
     {
         const bool sym = radioSymmetric->isChecked();
         const QString dataType = typeSelector->currentText();
+        Solver::setEquilibration(equilibrateCheck->isChecked());
+        Solver::setConditionEstimate(condCheck->isChecked());
 
         try {
+        /* ======= 0a) zadana dokładność: double → mpreal → przedziały */
+            if (dataType.contains("dokładność"))
+            {
+                auto A = Parser::parseMatrix<mpfr::mpreal>(matrixAInputs);
+                auto b = Parser::parseVector<mpfr::mpreal>(vectorBInputs);
+
+                bool ok = false;
+                const double tol = toleranceInput->text().toDouble(&ok);
+                if (!ok || tol <= 0) {
+                    resultDisplay->setText("Błąd: tolerancja musi być liczbą dodatnią");
+                    return;
+                }
+                const bool guaranteed = dataType.contains("gwarancją");
+
+                auto res = sym ? Solver::solveCroutSymmetricToTolerance(A,b,tol,guaranteed)
+                               : Solver::solveCroutTridiagonalToTolerance(A,b,tol,guaranteed);
+
+                auto tierName = [](Arithmetic t) {
+                    return t == Arithmetic::Double ? QString("double")
+                         : t == Arithmetic::MPReal ? QString("mpreal")
+                                                   : QString("przedziały");
+                };
+
+                QString out;
+                if (res.st == -1)
+                    out += "Nie udało się udowodnić otoczki "
+                           "(macierz źle uwarunkowana lub osobliwa)\n";
+                else if (res.st) {
+                    resultDisplay->setText(
+                        QString("Układ osobliwy – pivot zerowy w kroku %1").arg(res.st));
+                    return;
+                }
+                else {
+                    for (size_t i=0;i<res.x.size();++i)
+                    {
+                        interval_arithmetic::Interval<mpreal> I(res.x[i], res.x[i]);
+                        std::string L, R;
+                        I.IEndsToStrings(L, R);
+                        out += QString("x[%1] = %2\n")
+                                .arg(i + 1)
+                                .arg(QString::fromStdString(L));
+                    }
+                    out += QString("\nwynik: %1, %2 bitów, błąd względny ≤ %3%4\n")
+                            .arg(tierName(res.tier))
+                            .arg(res.precision)
+                            .arg(res.error, 0, 'e', 2)
+                            .arg(res.tier == Arithmetic::Interval ? QString(" (udowodniony)")
+                                                                  : QString(" (oszacowanie)"));
+                }
+
+                out += "\npoziomy:\n";
+                for (const TierTiming& t : res.timings)
+                    out += QString("  %1 (%2 bitów): %3 ms, błąd %4\n")
+                            .arg(tierName(t.tier), -10)
+                            .arg(t.precision)
+                            .arg(t.seconds * 1e3, 0, 'f', 3)
+                            .arg(t.error, 0, 'e', 2);
+                resultDisplay->setText(out);
+            }
+
+        /* ======= 0)  mpreal z poprawianiem (rozkład double) === */
+            else if (dataType.contains("poprawianiem"))
+            {
+                auto A = Parser::parseMatrix<mpfr::mpreal>(matrixAInputs);
+                auto b = Parser::parseVector<mpfr::mpreal>(vectorBInputs);
+
+                auto res = sym ? Solver::solveCroutSymmetricRefined(A,b)
+                               : Solver::solveCroutTridiagonalRefined(A,b);
+                if (res.st) {
+                    resultDisplay->setText(
+                        QString("Układ osobliwy – pivot zerowy w kroku %1").arg(res.st));
+                    return;
+                }
+
+                QString out;
+                for (size_t i=0;i<res.x.size();++i)
+                {
+                    interval_arithmetic::Interval<mpreal> I(res.x[i], res.x[i]);
+                    std::string L, R;
+                    I.IEndsToStrings(L, R);
+                    out += QString("x[%1] = %2\n")
+                            .arg(i + 1)
+                            .arg(QString::fromStdString(L));
+                }
+                out += QString("\nkroki poprawiania: %1%2")
+                        .arg(res.iterations)
+                        .arg(res.fallback ? QString("  (zastój – pełny rozkład mpreal)")
+                                          : QString());
+                resultDisplay->setText(out);
+            }
+
         /* ======= 1)  double ================================= */
-            if (dataType.contains("double"))
+            else if (dataType.contains("double"))
             {
                 auto A = Parser::parseMatrix<double>(matrixAInputs);
                 auto b = Parser::parseVector<double>(vectorBInputs);
 
                 Vector<double> x;
                 int st = 0;
+                double cond = 0;                           // κ₁(A) z czynników
 
                 if (sym) {                                 // ← nic nie zmieniamy
                     auto res = Solver::solveCroutSymmetric(A,b);
-                    x  = std::move(res.x);
-                    st = res.st;
+                    x    = std::move(res.x);
+                    st   = res.st;
+                    cond = res.cond;
                 } else {
                     auto res = Solver::solveCroutTridiagonal(A,b);
-                    x  = std::move(res.x);
-                    st = res.st;
+                    x    = std::move(res.x);
+                    st   = res.st;
+                    cond = res.cond;
                 }
                 if (st) {                       /* zerowy pivot */
                     resultDisplay->setText(
@@ -85,6 +172,8 @@ MainWindow::MainWindow(QWidget *parent) : QWidget(parent)
                             .arg(i + 1)
                             .arg(QString::fromStdString(ss.str()));
                 }
+                if (cond > 0)
+                    out += QString("\nκ₁(A) ≈ %1").arg(cond, 0, 'e', 2);
                 resultDisplay->setText(out);
             }
 
@@ -97,15 +186,18 @@ MainWindow::MainWindow(QWidget *parent) : QWidget(parent)
 
                 Vector<mpfr::mpreal> x;
                 int st = 0;
+                double cond = 0;                           // κ₁(A) z czynników
 
                 if (sym) {                                 // ← nic nie zmieniamy
                     auto res = Solver::solveCroutSymmetric(A,b);
-                    x  = std::move(res.x);
-                    st = res.st;
+                    x    = std::move(res.x);
+                    st   = res.st;
+                    cond = res.cond;
                 } else {
                     auto res = Solver::solveCroutTridiagonal(A,b);
-                    x  = std::move(res.x);
-                    st = res.st;
+                    x    = std::move(res.x);
+                    st   = res.st;
+                    cond = res.cond;
                 }
                 if (st) {
                     resultDisplay->setText(
@@ -126,6 +218,8 @@ MainWindow::MainWindow(QWidget *parent) : QWidget(parent)
                             .arg(i + 1)
                             .arg(QString::fromStdString(L));
                 }
+                if (cond > 0)
+                    out += QString("\nκ₁(A) ≈ %1").arg(cond, 0, 'e', 2);
                 resultDisplay->setText(out);
             }
 
@@ -137,9 +231,14 @@ MainWindow::MainWindow(QWidget *parent) : QWidget(parent)
 
                 Vector<IntervalMP> x;
                 int st = 0;
+                const bool verified = dataType.contains("weryfikowane");
 
-                
-                if (sym) {                                 // ← nic nie zmieniamy
+                if (verified) {                            // otoczka Krawczyka
+                    auto res = sym ? Solver::solveCroutSymmetricVerified(A,b)
+                                   : Solver::solveCroutTridiagonalVerified(A,b);
+                    x  = std::move(res.x);
+                    st = res.st;
+                } else if (sym) {                          // ← nic nie zmieniamy
                     auto res = Solver::solveCroutSymmetric(A,b);
                     x  = std::move(res.x);
                     st = res.st;
@@ -149,6 +248,11 @@ MainWindow::MainWindow(QWidget *parent) : QWidget(parent)
                     st = res.st;
                 }
 
+                if (st == -1) {
+                    resultDisplay->setText("Nie udało się udowodnić otoczki "
+                                           "(macierz źle uwarunkowana lub osobliwa)");
+                    return;
+                }
                 if (st) {
                     resultDisplay->setText(
                         QString("Układ osobliwy – pivot zerowy w kroku %1").arg(st));
@@ -169,8 +273,9 @@ MainWindow::MainWindow(QWidget *parent) : QWidget(parent)
                     mpreal lo = x[i].lower();         // dokładnie RNDD
                     mpreal hi = x[i].upper();         // dokładnie RNDU
 
-                    /* 2. jeżeli przedział wąski →  „wyrównaj” do ładnej liczby */
-                    if (hi - lo < mpreal("1e-20"))
+                    /* 2. jeżeli przedział wąski →  „wyrównaj” do ładnej liczby
+                          (nie dla otoczki weryfikowanej – zgubiłaby gwarancję) */
+                    if (!verified && hi - lo < mpreal("1e-20"))
                     {
                         lo = hi = round(lo*4)/4;      // przyciąga do k/4
                     }
@@ -210,6 +315,14 @@ void MainWindow::setupUI() {
     typeSelector->addItem("Liczby zmiennoprzecinkowe (double)");
     typeSelector->addItem("Liczby wysokiej precyzji (mpreal)");
     typeSelector->addItem("Przedziały (interval<mpreal>)");
+    typeSelector->addItem("Wysoka precyzja z poprawianiem (rozkład double, reszty mpreal)");
+    typeSelector->addItem("Przedziały weryfikowane (interval<mpreal>, Krawczyk)");
+    typeSelector->addItem("Zadana dokładność (double → mpreal)");
+    typeSelector->addItem("Zadana dokładność z gwarancją (double → mpreal → przedziały)");
+
+    toleranceLabel = new QLabel("Tolerancja:", this);
+    toleranceInput = new QLineEdit("1e-30", this);
+    toleranceInput->setFixedWidth(80);
 
     QGroupBox *matrixTypeGroup = new QGroupBox("Typ macierzy:", this);
     radioSymmetric = new QRadioButton("Symetryczna", this);
@@ -219,6 +332,11 @@ void MainWindow::setupUI() {
     QVBoxLayout *radioLayout = new QVBoxLayout();
     radioLayout->addWidget(radioSymmetric);
     radioLayout->addWidget(radioTridiagonal);
+
+    equilibrateCheck = new QCheckBox("Równoważenie (skale 2^k)", this);
+    radioLayout->addWidget(equilibrateCheck);
+    condCheck = new QCheckBox("Oszacuj κ₁(A)", this);
+    radioLayout->addWidget(condCheck);
     matrixTypeGroup->setLayout(radioLayout);
 
     inputHeaderLabel = new QLabel("Dane wejściowe:", this);
@@ -253,6 +371,8 @@ void MainWindow::setupUI() {
     settingsLayout->addSpacing(20);
     settingsLayout->addWidget(dataTypeLabel);
     settingsLayout->addWidget(typeSelector);
+    settingsLayout->addWidget(toleranceLabel);
+    settingsLayout->addWidget(toleranceInput);
     settingsLayout->addSpacing(20);
     settingsLayout->addWidget(matrixTypeGroup);
 
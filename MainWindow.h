@@ -5,9 +5,11 @@
 #include <QSpinBox>
 #include <QComboBox>
 #include <QRadioButton>
+#include <QCheckBox>
 #include <QPushButton>
 #include <QTextEdit>
 #include <QLabel>
+#include <QLineEdit>
 #include <QGridLayout>
 #include <QVBoxLayout>
 #include <QHBoxLayout>
@@ -32,8 +34,13 @@ private:
     QLabel      *dataTypeLabel;
     QComboBox   *typeSelector;
 
+    QLabel      *toleranceLabel;    // dla trybu „zadana dokładność”
+    QLineEdit   *toleranceInput;
+
     QRadioButton *radioSymmetric;
     QRadioButton *radioTridiagonal;
+    QCheckBox    *equilibrateCheck;  // Solver::setEquilibration
+    QCheckBox    *condCheck;         // Solver::setConditionEstimate
 
     QLabel      *inputHeaderLabel;
     QLabel      *matrixALabel;
@@ -70,14 +70,17 @@ IntervalMP parseValue<IntervalMP>(const QString &text)
 
 
 template<typename T>
-std::vector<std::vector<T>> Parser::parseMatrix(const QVector<QVector<QLineEdit*>> &inputs) {
-    std::vector<std::vector<T>> matrix;
-    for (const auto& row : inputs) {
-        std::vector<T> rowValues;
-        for (QLineEdit* cell : row) {
-            rowValues.push_back(parseValue<T>(cell->text()));
+DenseMatrix<T> Parser::parseMatrix(const QVector<QVector<QLineEdit*>> &inputs) {
+    const int rows = inputs.size();
+    const int cols = rows ? inputs[0].size() : 0;
+    DenseMatrix<T> matrix(rows, cols);
+    for (int i = 0; i < rows; ++i) {
+        if (inputs[i].size() != cols) {
+            throw std::runtime_error("Niepoprawny rozmiar macierzy");
+        }
+        for (int j = 0; j < cols; ++j) {
+            matrix(i, j) = parseValue<T>(inputs[i][j]->text());
         }
-        matrix.push_back(rowValues);
     }
     return matrix;
 }
@@ -92,9 +95,9 @@ std::vector<T> Parser::parseVector(const QVector<QLineEdit*> &inputs) {
 }
 
 // Wymuszenie instancji
-template std::vector<std::vector<double>> Parser::parseMatrix(const QVector<QVector<QLineEdit*>> &);
-template std::vector<std::vector<mpreal>> Parser::parseMatrix(const QVector<QVector<QLineEdit*>> &);
-template std::vector<std::vector<IntervalMP>> Parser::parseMatrix(const QVector<QVector<QLineEdit*>> &);
+template DenseMatrix<double> Parser::parseMatrix(const QVector<QVector<QLineEdit*>> &);
+template DenseMatrix<mpreal> Parser::parseMatrix(const QVector<QVector<QLineEdit*>> &);
+template DenseMatrix<IntervalMP> Parser::parseMatrix(const QVector<QVector<QLineEdit*>> &);
 
 template std::vector<double> Parser::parseVector(const QVector<QLineEdit*> &);
 template std::vector<mpreal> Parser::parseVector(const QVector<QLineEdit*> &);
@@ -9,27 +9,18 @@
 #include <stdexcept>
 
 #include "mpreal.h"
-#include <boost/numeric/interval.hpp>
-#include <boost/numeric/interval/rounded_transc.hpp>
-#include <boost/numeric/interval/policies.hpp>
+#include "DenseMatrix.h"
+#include "IntervalMP.h"
 
 using mpfr::mpreal;
 using namespace boost::numeric;
 
-using IntervalMP = interval<
-        mpreal,
-        interval_lib::policies<
-            interval_lib::save_state<interval_lib::rounded_transc_std<mpreal>>,
-            interval_lib::checking_no_nan<mpreal>
-        >
->;
-
 class Parser
 {
 public:
     /* --------- oryginalne wersje (QVector) ------------------ */
     template<typename T>
-    static std::vector<std::vector<T>>
+    static DenseMatrix<T>
     parseMatrix(const QVector<QVector<QLineEdit *>> &inputs);
 
     template<typename T>
@@ -42,7 +33,7 @@ public:
      *  (muszą być *zdefiniowane* tutaj, w nagłówku!)
      * ========================================================= */
     template<typename T>
-    static std::vector<std::vector<T>>
+    static DenseMatrix<T>
     parseMatrix(const std::vector<std::vector<QLineEdit *>> &inputs)
     {
         QVector<QVector<QLineEdit *>> tmp;
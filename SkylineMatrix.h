@@ -0,0 +1,130 @@
+#pragma once
+/* ============================================================
+ *  SkylineMatrix.h  – macierz symetryczna w zapisie profilowym
+ *
+ *  Pamiętany jest tylko dolny trójkąt, wiersz po wierszu, od
+ *  pierwszego niezera f_i do przekątnej:
+ *      A[i][j]  →  a[ ptr[i] + (j - f_i) ],   f_i ≤ j ≤ i
+ *  Wiersz jest ciągły, więc rekurencje Crouta to iloczyny
+ *  skalarne kawałków wierszy.  Rozkład LDLᵀ nie wychodzi poza
+ *  profil (wypełnienie tylko wewnątrz obwiedni).
+ *  Pamięć Σ (i - f_i + 1) zamiast n².
+ * ============================================================ */
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+#include <algorithm>
+#include "DenseMatrix.h"
+#include "SparseMatrix.h"
+
+template<typename T>
+class SkylineMatrix
+{
+public:
+    SkylineMatrix() = default;
+
+    /* pusty profil: first[i] – pierwsza kolumna wiersza i (≤ i) */
+    explicit SkylineMatrix(std::vector<int> first)
+        : n_(int(first.size())), f(std::move(first)), ptr(n_ + 1, 0)
+    {
+        for (int i = 0; i < n_; ++i) {
+            if (f[i] < 0 || f[i] > i)
+                throw std::invalid_argument("SkylineMatrix: niepoprawny profil");
+            ptr[i + 1] = ptr[i] + std::size_t(i - f[i] + 1);
+        }
+        a.assign(ptr[n_], T(0));
+    }
+
+    /* obwiednia dolnego trójkąta pełnej macierzy */
+    explicit SkylineMatrix(const DenseMatrix<T>& A)
+        : SkylineMatrix(envelope(A))
+    {
+        for (int i = 0; i < n_; ++i)
+            for (int j = f[i]; j <= i; ++j) (*this)(i, j) = A(i, j);
+    }
+
+    /* dolny trójkąt  C = P·A·Pᵀ,  perm[k] – kolumna A na pozycji k
+       (pusty perm – bez przestawień) */
+    explicit SkylineMatrix(const SparseMatrix<T>& A,
+                           const std::vector<int>& perm = {})
+        : SkylineMatrix(envelope(A, inverse(A.size(), perm)))
+    {
+        const std::vector<int> ip = inverse(A.size(), perm);
+        const auto& cp = A.colPtr();
+        const auto& ri = A.rowIdx();
+        const auto& vx = A.values();
+        for (int j = 0; j < n_; ++j)
+            for (int q = cp[j]; q < cp[j + 1]; ++q)
+                if (ri[q] >= j) {
+                    const int r = ip[ri[q]], c = ip[j];
+                    (*this)(std::max(r, c), std::min(r, c)) += vx[q];
+                }
+    }
+
+    int size()         const { return n_; }
+    int first(int i)   const { return f[i]; }
+    std::size_t profile() const { return ptr[n_]; }   // liczba pamiętanych wpisów
+
+    bool inProfile(int i, int j) const { return j >= f[i] && j <= i; }
+
+    T& operator()(int i, int j)             { return a[ptr[i] + (j - f[i])]; }
+    const T& operator()(int i, int j) const { return a[ptr[i] + (j - f[i])]; }
+
+    /* wiersz i od kolumny first(i) */
+    T*       row(int i)       { return a.data() + ptr[i]; }
+    const T* row(int i) const { return a.data() + ptr[i]; }
+
+private:
+    static std::vector<int> envelope(const DenseMatrix<T>& A)
+    {
+        if (A.rows() != A.cols())
+            throw std::invalid_argument("SkylineMatrix: macierz nie jest kwadratowa");
+        std::vector<int> first(A.rows());
+        for (int i = 0; i < A.rows(); ++i) {
+            int j = 0;
+            while (j < i && A(i, j) == T(0)) ++j;
+            first[i] = j;
+        }
+        return first;
+    }
+
+    static std::vector<int> envelope(const SparseMatrix<T>& A,
+                                     const std::vector<int>& ip)
+    {
+        std::vector<int> first(A.size());
+        for (int i = 0; i < A.size(); ++i) first[i] = i;
+        const auto& cp = A.colPtr();
+        const auto& ri = A.rowIdx();
+        for (int j = 0; j < A.size(); ++j)
+            for (int q = cp[j]; q < cp[j + 1]; ++q)
+                if (ri[q] >= j) {
+                    const int r = ip[ri[q]], c = ip[j];
+                    int& fr = first[std::max(r, c)];
+                    fr = std::min(fr, std::min(r, c));
+                }
+        return first;
+    }
+
+    static std::vector<int> inverse(int n, const std::vector<int>& perm)
+    {
+        std::vector<int> ip(n);
+        if (perm.empty()) {
+            for (int k = 0; k < n; ++k) ip[k] = k;
+            return ip;
+        }
+        if (int(perm.size()) != n)
+            throw std::invalid_argument("SkylineMatrix: niepoprawna permutacja");
+        std::fill(ip.begin(), ip.end(), -1);
+        for (int k = 0; k < n; ++k) {                   // zakres i powtórzenia
+            if (perm[k] < 0 || perm[k] >= n || ip[perm[k]] >= 0)
+                throw std::invalid_argument("SkylineMatrix: niepoprawna permutacja");
+            ip[perm[k]] = k;
+        }
+        return ip;
+    }
+
+    int n_ = 0;
+    std::vector<int>         f;
+    std::vector<std::size_t> ptr{0};
+    std::vector<T, AlignedAllocator<T>> a;
+};
@@ -2,8 +2,19 @@
  *  Solver.cpp
  * ========================================================= */
 #include "Solver.h"
+#include "Kernels.h"
+#include "ThreadPool.h"
+#include "Verified.h"
 #include <stdexcept>
+#include <string>
 #include <cmath>          // std::abs – dla double/long double
+#include <algorithm>      // std::max
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <chrono>
+#include <limits>
+#include <climits>
 
 /* ---------- uniwersalny |x| dla wszystkich typów --------- */
 template<typename T>
@@ -15,155 +26,1857 @@ inline T aabs(const T& x)
     return abs(x);
 }
 
+/* ---------- test pivota ----------------------------------
+   Przedział z zaokrąglaniem na zewnątrz ma niezerową szerokość,
+   a boost::interval rzuca przy porównaniu niepewnym.  Pivot
+   przedziałowy odrzucamy, gdy *może* być zerem / mniejszy od
+   eps – i tak nie dałoby się przez niego dzielić.            */
+template<typename T>
+inline bool tinyPivot(const T& x, const T& eps) { return aabs(x) < eps; }
+inline bool tinyPivot(const IntervalMP& x, const IntervalMP& eps)
+{
+    return aabs(x).lower() < eps.upper();
+}
+
+template<typename T>
+inline bool zeroPivot(const T& x) { return x == T(0); }
+inline bool zeroPivot(const IntervalMP& x) { return zero_in(x); }
+
+/* ---------- przybliżenie double (normy, znaki) ---------- */
+inline double asDouble(double v)            { return v; }
+inline double asDouble(const mpreal& v)     { return v.toDouble(); }
+inline double asDouble(const IntervalMP& v) { return median(v).toDouble(); }
+
+/* ---------- wykładnik: |a| = m·2^e, ½ ≤ m < 1 (0 → INT_MIN) */
+inline int binExp(double v)
+{
+    return v == 0 || !std::isfinite(v) ? INT_MIN : std::ilogb(v) + 1;
+}
+inline int binExp(const mpreal& v)
+{
+    return mpfr_regular_p(v.mpfr_srcptr()) ? int(mpfr_get_exp(v.mpfr_srcptr())) : INT_MIN;
+}
+inline int binExp(const IntervalMP& v)
+{
+    return std::max(binExp(v.lower()), binExp(v.upper()));
+}
+
+/* ---------- a·2^k – dokładnie, bez zaokrąglenia ---------- */
+inline void scale2(double& a, int k) { a = std::ldexp(a, k); }
+inline void scale2(mpreal& a, int k)
+{
+    mpfr_mul_2si(a.mpfr_ptr(), a.mpfr_srcptr(), k, MPFR_RNDN);
+}
+inline void scale2(IntervalMP& a, int k)
+{
+    mpreal lo = a.lower(), hi = a.upper();
+    scale2(lo, k);
+    scale2(hi, k);
+    a = IntervalMP(lo, hi);
+}
+
+/* ---------- rozmiar kafelka dla typu T ------------------- */
+template<typename T>
+int blockSizeFor(int n)
+{
+    int nb = Solver::blockSize();
+    if (nb <= 0)                        // kafelek double 64×64 = 32 KB
+        nb = sizeof(T) <= sizeof(double) ? 64 : 32;
+    return std::max(1, std::min(nb, n));
+}
+
+using RefKind = CroutFactorization<double>::Kind;
+
+/* ---------- równoważenie (Solver::setEquilibration) ------
+   Ruiz (2001) na wykładnikach:  r_i, c_j – skale 2^r_i, 2^c_j,
+   w każdym kroku wiersz i kolumna dzielone przez ≈ √max,
+   aż największy element każdego wiersza i kolumny leży
+   w [½, 4).  Skale to potęgi dwójki, więc A·skale jest
+   dokładne także w mpreal i na przedziałach, a zakres nie
+   ogranicza się do double.  Macierz symetryczną czytamy
+   dolnym trójkątem (odbitym), wtedy r = c. */
+struct Scaling
+{
+    std::vector<int> r, c;
+};
+
+template<typename T>
+Scaling equilibrate(const Matrix<T>& A, RefKind kind)
+{
+    const int n = A.size();
+    Scaling S{ std::vector<int>(n, 0), std::vector<int>(n, 0) };
+    std::vector<int> mr(n), mc(n);
+
+    for (int pass = 0; pass < 16; ++pass)
+    {
+        std::fill(mr.begin(), mr.end(), INT_MIN);
+        std::fill(mc.begin(), mc.end(), INT_MIN);
+        for (int i = 0; i < n; ++i)
+        {
+            const int j0 = kind == RefKind::Tridiagonal ? std::max(0, i - 1) : 0;
+            const int j1 = kind == RefKind::Tridiagonal ? std::min(n, i + 2) : n;
+            for (int j = j0; j < j1; ++j)
+            {
+                const int e = binExp(kind == RefKind::Symmetric && j > i ? A[j][i] : A[i][j]);
+                if (e == INT_MIN) continue;
+                const int t = e + S.r[i] + S.c[j];
+                mr[i] = std::max(mr[i], t);
+                mc[j] = std::max(mc[j], t);
+            }
+        }
+
+        bool done = true;
+        for (int i = 0; i < n; ++i) {
+            if (mr[i] != INT_MIN && (mr[i] - 1) / 2) { S.r[i] -= (mr[i] - 1) / 2; done = false; }
+            if (mc[i] != INT_MIN && (mc[i] - 1) / 2) { S.c[i] -= (mc[i] - 1) / 2; done = false; }
+        }
+        if (done) break;
+    }
+    return S;
+}
+
+template<typename T>
+Matrix<T> scaled(const Matrix<T>& A, const Scaling& S)
+{
+    const int n = A.size();
+    Matrix<T> B(A);
+    for (int i = 0; i < n; ++i)
+        for (int j = 0; j < n; ++j) scale2(B[i][j], S.r[i] + S.c[j]);
+    return B;
+}
+
+/* b → Dr·b,  y → Dc·y */
+template<typename T>
+Vector<T> scaled(Vector<T> v, const std::vector<int>& d)
+{
+    for (std::size_t i = 0; i < std::min(v.size(), d.size()); ++i) scale2(v[i], d[i]);
+    return v;
+}
+
+/* ---------- κ₁ tylko na życzenie (Solver::setConditionEstimate) */
+template<typename T>
+double condEstimate(const CroutFactorization<T>& F)
+{
+    return Solver::conditionEstimate() ? F.conditionEstimate() : 0;
+}
+
+/* ---------- pętla równoległa po [begin, end) -------------
+   f(i0, i1) dostaje spójny kawałek zakresu.  Wątki tylko dla
+   typów programowych (mpreal, IntervalMP), gdzie jedno
+   mnożenie kosztuje setki ns; double idzie jednym kawałkiem.
+   Domyślna precyzja i zaokrąglenie MPFR są lokalne dla
+   wątku, więc przekazujemy je z wątku wołającego.
+   ----------------------------------------------------------- */
+ThreadPool& threadPool()
+{
+    static std::unique_ptr<ThreadPool> pool;
+    if (!pool || pool->size() != Solver::threadCount())
+        pool = std::make_unique<ThreadPool>(Solver::threadCount());
+    return *pool;
+}
+
+/* zadania 0..tasks-1 na puli, zawsze (także dla double) */
+template<typename F>
+void runTasks(int tasks, F&& f)
+{
+    const mp_prec_t prec = mpreal::get_default_prec();
+    const mp_rnd_t  rnd  = mpreal::get_default_rnd();
+
+    threadPool().run(tasks, [&](int t) {
+        mpreal::set_default_prec(prec);
+        mpreal::set_default_rnd(rnd);
+        f(t);
+    });
+}
+
+template<typename T, typename F>
+void parallelFor(int begin, int end, F&& f)
+{
+    const int nt = Solver::threadCount();
+    if (std::is_arithmetic<T>::value || nt <= 1 || end - begin < 2) {
+        if (begin < end) f(begin, end);
+        return;
+    }
+
+    const int len   = end - begin;
+    const int tasks = std::min(len, 4 * nt);
+
+    runTasks(tasks, [&](int t) {
+        f(begin + int(std::int64_t(len) * t / tasks),
+          begin + int(std::int64_t(len) * (t + 1) / tasks));
+    });
+}
+
+/* -----------------------------------------------------------
+   1.  Pełna macierz – klasyczny LU-Crout, panelami
+
+       F trzyma L (z przekątną) i U (bez jedynek).  Zanim
+       element zostanie domknięty, w F leży jego suma s.
+       Wkład starszych paneli (k < J0) dodawany jest kafelkami
+       nb×nb, ale dla każdego elementu wciąż w kolejności
+       k = 0, 1, …, j-1 – wynik jest bit w bit taki sam jak
+       w wersji bez kafelków.
+   ----------------------------------------------------------- */
+template<typename T>
+int croutFactor(const Matrix<T>& A, Matrix<T>& F, int nb)
+{
+    const int n = A.size();
+    F = Matrix<T>(n, n);
+
+    for (int J0 = 0; J0 < n; J0 += nb)
+    {
+        const int J1 = std::min(n, J0 + nb);
+
+        parallelFor<T>(J0, n, [&](int i0, int i1) {     // kolumny J
+            for (int K0 = 0; K0 < J0; K0 += nb) {       // panele k < J0
+                const int K1 = std::min(J0, K0 + nb);
+                for (int i = i0; i < i1; ++i)
+                    for (int k = K0; k < K1; ++k)
+                        kernels::axpy(J1 - J0, F[i][k], F[k] + J0, F[i] + J0);
+            }
+        });
+
+        parallelFor<T>(J1, n, [&](int c0, int c1) {     // wiersze J
+            for (int K0 = 0; K0 < J0; K0 += nb) {
+                const int K1 = std::min(J0, K0 + nb);
+                for (int C0 = c0; C0 < c1; C0 += nb) {
+                    const int C1 = std::min(c1, C0 + nb);
+                    for (int i = J0; i < J1; ++i)
+                        for (int k = K0; k < K1; ++k)
+                            kernels::axpy(C1 - C0, F[i][k], F[k] + C0, F[i] + C0);
+                }
+            }
+        });
+
+        for (int j = J0; j < J1; ++j)                   // wnętrze panelu
+        {
+            parallelFor<T>(j, n, [&](int i0, int i1) {  // kolumna L
+                for (int i = i0; i < i1; ++i)
+                {
+                    T s = F[i][j];
+                    for (int k = J0; k < j; ++k) kernels::mulAdd(s, F[i][k], F[k][j]);
+                    F[i][j] = A[i][j] - s;
+                }
+            });
+            if (zeroPivot(F[j][j])) return j + 1;
+
+            parallelFor<T>(j + 1, n, [&](int c0, int c1) {   // wiersz U
+                for (int k = J0; k < j; ++k)
+                    kernels::axpy(c1 - c0, F[j][k], F[k] + c0, F[j] + c0);
+                for (int i = c0; i < c1; ++i)
+                    F[j][i] = (A[j][i] - F[j][i]) / F[j][j];
+            });
+        }
+    }
+    return 0;
+}
+
+template<typename T>
+void croutSolve(const Matrix<T>& F, T* x)
+{
+    const int n = F.size();
+    for (int i = 0; i < n; ++i)                         // Ly = b
+    {
+        T s = kernels::dot(i, F[i], x);
+        x[i] = (x[i] - s) / F[i][i];
+    }
+    for (int i = n - 1; i >= 0; --i)                    // Ux = y
+    {
+        T s = kernels::dot(n - i - 1, F[i] + i + 1, x + i + 1);
+        x[i] = x[i] - s;
+    }
+}
+
+template<typename T>
+Vector<T> Solver::solveCrout(const Matrix<T>& A, const Vector<T>& b)
+{
+    if (equilibration()) {
+        const Scaling S = equilibrate(A, RefKind::Dense);
+        const CroutFactorization<T> F = factor(scaled(A, S));
+        if (F.status())
+            throw std::runtime_error("Pivot zero – Crout");
+        return scaled(F.solve(scaled(b, S.r)), S.c);
+    }
+
+    const CroutFactorization<T> F = factor(A);
+    if (F.status())
+        throw std::runtime_error("Pivot zero – Crout");
+    return F.solve(b);
+}
+
+/* -----------------------------------------------------------
+   2.  Pełna macierz SYMETRYCZNA – z kodem st
+       Crout w wariancie LDLᵀ: czytamy tylko dolny trójkąt A,
+       czynnik trzymamy w postaci spakowanej (wierszami),
+       U = D⁻¹Lᵀ nie jest liczone wcale.
+
+       P[ i(i+1)/2 + k ]  =  L[i][k]   (k < i,  L – jednostkowa)
+       P[ i(i+1)/2 + i ]  =  d_i       (= L[i][i] z wersji Crouta)
+
+       Panele jak w 1.: Wt[k][j] = L[j][k]·d_k dla j z panelu
+       liczone raz na panel, sumy zbierane w P.
+   ----------------------------------------------------------- */
+inline std::size_t packedRow(int i)
+{
+    return static_cast<std::size_t>(i) * (i + 1) / 2;
+}
+
+template<typename T>
+int ldltFactor(const Matrix<T>& A, Vector<T>& P, int nb)
+{
+    const int n   = A.size();
+    const T   eps = T(1e-20);
+
+    P.assign(packedRow(n), T(0));
+    Vector<T> Wt(std::size_t(n) * nb);      // Wt[k*nb + j-J0] = L[j][k]·d_k
+    Vector<T> w(nb);                        // to samo wewnątrz panelu
+
+    for (int J0 = 0; J0 < n; J0 += nb)
+    {
+        const int J1 = std::min(n, J0 + nb);
+
+        parallelFor<T>(0, J0, [&](int k0, int k1) {
+            for (int k = k0; k < k1; ++k)
+                for (int j = J0; j < J1; ++j)
+                    Wt[std::size_t(k)*nb + (j - J0)] =
+                        P[packedRow(j) + k]*P[packedRow(k) + k];
+        });
+
+        parallelFor<T>(J0, n, [&](int i0, int i1) {
+            for (int K0 = 0; K0 < J0; K0 += nb) {       // panele k < J0
+                const int K1 = std::min(J0, K0 + nb);
+                for (int i = i0; i < i1; ++i)
+                {
+                    T* Li = &P[packedRow(i)];
+                    const int jEnd = std::min(J1, i + 1);
+                    for (int k = K0; k < K1; ++k)
+                        kernels::axpy(jEnd - J0, Li[k], &Wt[std::size_t(k)*nb], Li + J0);
+                }
+            }
+        });
+
+        for (int j = J0; j < J1; ++j)                   // wnętrze panelu
+        {
+            T* Lj = &P[packedRow(j)];
+
+            for (int k = J0; k < j; ++k) w[k - J0] = Lj[k]*P[packedRow(k) + k];
+
+            T s = kernels::dot(j - J0, Lj + J0, w.data(), Lj[j]);   // pivot d_j
+            Lj[j] = A[j][j] - s;
+
+            /* —— przerwij tylko przy PIVOCIE ≈ 0 ——————— */
+            if (tinyPivot(Lj[j], eps)) return j + 1;
+
+            parallelFor<T>(j + 1, n, [&](int i0, int i1) {   // kolumna L
+                for (int i = i0; i < i1; ++i)
+                {
+                    T* Li = &P[packedRow(i)];
+                    T si = kernels::dot(j - J0, Li + J0, w.data(), Li[j]);
+                    Li[j] = (A[i][j] - si) / Lj[j];
+                }
+            });
+        }
+    }
+    return 0;
+}
+
+template<typename T>
+void ldltSolve(const Vector<T>& P, int n, T* x)
+{
+    for (int i = 0; i < n; ++i)                         // Lz = b
+    {
+        const T* Li = &P[packedRow(i)];
+        T s = kernels::dot(i, Li, x);
+        x[i] = x[i] - s;
+    }
+    for (int i = 0; i < n; ++i)                         // Dy = z
+        x[i] = x[i] / P[packedRow(i) + i];
+    for (int i = n - 1; i > 0; --i)                     // Lᵀx = y
+    {
+        const T* Li = &P[packedRow(i)];                 // kolumnami Lᵀ
+        kernels::axpy(i, -x[i], Li, x);
+    }
+}
+
+template<typename T>
+TriResult<T> Solver::solveCroutSymmetric(const Matrix<T>& A,
+                                         const Vector<T>& b)
+{
+    if (equilibration()) {
+        const Scaling S = equilibrate(A, RefKind::Symmetric);   // S.r = S.c
+        const CroutFactorization<T> F = factorSymmetric(scaled(A, S));
+        if (F.status())
+            return { Vector<T>(A.size(), T(0)), F.status() };
+        return { scaled(F.solve(scaled(b, S.r)), S.r), 0, condEstimate(F) };
+    }
+
+    const CroutFactorization<T> F = factorSymmetric(A);
+    if (F.status())
+        return { Vector<T>(A.size(), T(0)), F.status() };
+    return { F.solve(b), 0, condEstimate(F) };
+}
+
+/* -----------------------------------------------------------
+   3.  Macierz trójdiagonalna – z kodem st
+
+       Rdzeń działa w miejscu na trzech przekątnych:
+         sub[i] = A[i+1][i],  diag[i] = A[i][i],  sup[i] = A[i][i+1]
+       (sub, sup – długość n-1).  Po powrocie sup[i] = u_i,
+       b = x; diag zostaje nietknięta (l_i potrzebne jest tylko
+       w bieżącym kroku).  Przy st ≠ 0 zawartość sup i b jest
+       nieokreślona.
+   ----------------------------------------------------------- */
+template<typename T>
+int Solver::solveCroutTridiagonalInPlace(int n, const T* sub, const T* diag,
+                                         T* sup, T* b)
+{
+    const T eps = T(1e-20);
+    if (n <= 0) return 0;
+
+    T l = diag[0];
+    if (tinyPivot(l, eps)) return 1;
+
+    if (n > 1) sup[0] = sup[0] / l;
+    b[0] = b[0] / l;
+
+    for (int i = 1; i < n; ++i)
+    {
+        l = diag[i] - sub[i-1]*sup[i-1];
+        if (tinyPivot(l, eps)) return i + 1;
+
+        if (i < n-1) sup[i] = sup[i] / l;
+        b[i] = (b[i] - sub[i-1]*b[i-1]) / l;
+    }
+
+    for (int i = n - 2; i >= 0; --i)                    // Ux = y
+        b[i] = b[i] - sup[i]*b[i+1];
+    return 0;
+}
+
+template<typename T>
+TriResult<T> Solver::solveCroutTridiagonal(const Vector<T>& sub,
+                                           const Vector<T>& diag,
+                                           const Vector<T>& sup,
+                                           const Vector<T>& b)
+{
+    const int n = diag.size();
+    if (int(b.size()) != n ||
+        (n > 0 && (int(sub.size()) < n-1 || int(sup.size()) < n-1)))
+        throw std::invalid_argument("Niezgodne rozmiary przekątnych");
+
+    Vector<T> u(sup.begin(), sup.begin() + (n > 0 ? n-1 : 0));
+    Vector<T> x(b);
+
+    int st = solveCroutTridiagonalInPlace(n, sub.data(), diag.data(),
+                                          u.data(), x.data());
+    if (st) x.assign(n, T(0));
+    return { x, st };
+}
+
+template<typename T>
+TriResult<T> Solver::solveCroutTridiagonal(const Matrix<T>& A,
+                                           const Vector<T>& b)
+{
+    if (equilibration()) {
+        const int n = A.size();
+        const Scaling S = equilibrate(A, RefKind::Tridiagonal);
+        Vector<T> sub(n > 0 ? n-1 : 0), diag(n), sup(n > 0 ? n-1 : 0);
+        for (int i = 0; i < n; ++i) {
+            diag[i] = A[i][i];
+            scale2(diag[i], S.r[i] + S.c[i]);
+            if (i < n-1) {
+                sub[i] = A[i + 1][i];
+                sup[i] = A[i][i + 1];
+                scale2(sub[i], S.r[i + 1] + S.c[i]);
+                scale2(sup[i], S.r[i] + S.c[i + 1]);
+            }
+        }
+        const CroutFactorization<T> F = factorTridiagonal(sub, diag, sup);
+        if (F.status())
+            return { Vector<T>(n, T(0)), F.status() };
+        return { scaled(F.solve(scaled(b, S.r)), S.c), 0, condEstimate(F) };
+    }
+
+    const CroutFactorization<T> F = factorTridiagonal(A);   // l, u jak wyżej
+    if (F.status())
+        return { Vector<T>(A.size(), T(0)), F.status() };
+    return { F.solve(b), 0, condEstimate(F) };
+}
+
+/* -----------------------------------------------------------
+   4.  Macierz pasmowa (p pod, q nad przekątną) – z kodem st
+       Ten sam Crout co w 1., ale sumy biegną tylko po pasmie:
+       L dziedziczy pasmo p, U – pasmo q, więc oba czynniki
+       mieszczą się w miejscu A.  Koszt O(n·p·q).
+   ----------------------------------------------------------- */
+template<typename T>
+TriResult<T> Solver::solveCroutBanded(const BandMatrix<T>& A,
+                                      const Vector<T>& b)
+{
+    const int n   = A.size();
+    const int p   = A.lower();
+    const int q   = A.upper();
+    const T   eps = T(1e-20);
+    if (int(b.size()) != n)
+        throw std::invalid_argument("Niezgodny rozmiar prawej strony");
+
+    BandMatrix<T> F(A);                 // L (z przekątną) + U (bez 1)
+    int st = 0;
+
+    for (int j = 0; j < n; ++j)
+    {
+        const int iEnd = std::min(n - 1, j + p);
+        for (int i = j; i <= iEnd; ++i)                 // kolumna L
+        {
+            const int k0 = std::max(F.first(i), j - q);
+            T s = T(0);
+            for (int k = k0; k < j; ++k) kernels::mulAdd(s, F(i, k), F(k, j));
+            F(i, j) = F(i, j) - s;
+        }
+
+        /* —— przerwij tylko przy PIVOCIE ≈ 0 ——————— */
+        if (tinyPivot(F(j, j), eps)) {
+            st = j + 1;
+            break;
+        }
+
+        for (int i = j + 1; i <= F.last(j); ++i)        // wiersz U
+        {
+            const int k0 = std::max(F.first(j), i - q);
+            T s = T(0);
+            for (int k = k0; k < j; ++k) kernels::mulAdd(s, F(j, k), F(k, i));
+            F(j, i) = (F(j, i) - s) / F(j, j);
+        }
+    }
+
+    Vector<T> x(n, T(0));
+    if (st == 0)
+    {
+        for (int i = 0; i < n; ++i)                     // Ly = b
+        {
+            const int k0 = F.first(i);
+            T s = kernels::dot(i - k0, &F(i, k0), x.data() + k0);
+            x[i] = (b[i] - s) / F(i, i);
+        }
+        for (int i = n - 1; i >= 0; --i)                // Ux = y
+        {
+            T s = kernels::dot(F.last(i) - i, &F(i, i) + 1, x.data() + i + 1);
+            x[i] = x[i] - s;
+        }
+    }
+    return { x, st };
+}
+
+/* -----------------------------------------------------------
+   5.  Faktoryzacja wielokrotnego użytku
+       factor*() liczy czynniki raz, solve() kosztuje potem
+       O(n²) (pełna / symetryczna) albo O(n) (trójdiagonalna).
+   ----------------------------------------------------------- */
+template<typename T>
+int tridiagFactor(int n, const T* sub, const T* diag, const T* sup,
+                  T* l, T* u)
+{
+    const T eps = T(1e-20);
+    if (n == 0) return 0;
+
+    l[0] = diag[0];
+    if (tinyPivot(l[0], eps)) return 1;
+
+    for (int i = 1; i < n; ++i)
+    {
+        u[i-1] = sup[i-1] / l[i-1];
+        l[i] = diag[i] - sub[i-1]*u[i-1];
+        if (tinyPivot(l[i], eps)) return i + 1;
+    }
+    return 0;
+}
+
+/* Ly = b, Ux = y dla czynników z tridiagFactor, x ← b */
+template<typename T>
+void tridiagSweep(int n, const T* sub, const T* l, const T* u, T* x)
+{
+    if (n == 0) return;
+    x[0] = x[0] / l[0];
+    for (int i = 1; i < n; ++i)
+        x[i] = (x[i] - sub[i-1]*x[i-1]) / l[i];
+    for (int i = n - 2; i >= 0; --i)
+        x[i] = x[i] - u[i]*x[i+1];
+}
+
+/* Aᵀ = Uᵀ·Lᵀ:  Uᵀ – dolna z jedynkami, Lᵀ – górna z przekątną */
+template<typename T>
+void croutSolveTransposed(const Matrix<T>& F, T* x)
+{
+    const int n = F.size();
+    for (int k = 0; k < n - 1; ++k)                     // Uᵀy = b
+        kernels::axpy(n - k - 1, -x[k], F[k] + k + 1, x + k + 1);
+    for (int i = n - 1; i >= 0; --i)                    // Lᵀx = y
+    {
+        x[i] = x[i] / F[i][i];
+        kernels::axpy(i, -x[i], F[i], x);
+    }
+}
+
+template<typename T>
+void tridiagSweepTransposed(int n, const T* sub, const T* l, const T* u, T* x)
+{
+    if (n == 0) return;
+    for (int i = 1; i < n; ++i)                         // Uᵀy = b
+        x[i] = x[i] - u[i-1]*x[i-1];
+    x[n-1] = x[n-1] / l[n-1];
+    for (int i = n - 2; i >= 0; --i)                    // Lᵀx = y
+        x[i] = (x[i] - sub[i]*x[i+1]) / l[i];
+}
+
+/* ‖A‖₁ – największa suma kolumny;  lowerOnly: A symetryczna
+   dana dolnym trójkątem */
+template<typename T>
+double normOne(const Matrix<T>& A, bool lowerOnly)
+{
+    const int n = A.size();
+    std::vector<double> c(n, 0.0);
+    for (int i = 0; i < n; ++i)
+        for (int j = 0; j < (lowerOnly ? i + 1 : n); ++j) {
+            const double a = std::fabs(asDouble(A[i][j]));
+            c[j] += a;
+            if (lowerOnly && j < i) c[i] += a;
+        }
+    return n ? *std::max_element(c.begin(), c.end()) : 0.0;
+}
+
+template<typename T>
+CroutFactorization<T> Solver::factor(const Matrix<T>& A)
+{
+    CroutFactorization<T> F;
+    F.kind_ = CroutFactorization<T>::Kind::Dense;
+    F.n     = A.size();
+    F.anorm = normOne(A, false);
+    F.st    = croutFactor(A, F.F, blockSizeFor<T>(F.n));
+    return F;
+}
+
+template<typename T>
+CroutFactorization<T> Solver::factorSymmetric(const Matrix<T>& A)
+{
+    CroutFactorization<T> F;
+    F.kind_ = CroutFactorization<T>::Kind::Symmetric;
+    F.n     = A.size();
+    F.anorm = normOne(A, true);
+    F.st    = ldltFactor(A, F.P, blockSizeFor<T>(F.n));
+    return F;
+}
+
+template<typename T>
+CroutFactorization<T> Solver::factorTridiagonal(const Vector<T>& sub,
+                                                const Vector<T>& diag,
+                                                const Vector<T>& sup)
+{
+    const int n = diag.size();
+    if (n > 0 && (int(sub.size()) < n-1 || int(sup.size()) < n-1))
+        throw std::invalid_argument("Niezgodne rozmiary przekątnych");
+
+    CroutFactorization<T> F;
+    F.kind_ = CroutFactorization<T>::Kind::Tridiagonal;
+    F.n     = n;
+    F.sub.assign(sub.begin(), sub.begin() + (n > 0 ? n-1 : 0));
+    F.P.assign(n, T(0));
+    F.u.assign(n > 0 ? n-1 : 0, T(0));
+    for (int j = 0; j < n; ++j)
+        F.anorm = std::max(F.anorm, std::fabs(asDouble(diag[j]))
+                  + (j < n-1 ? std::fabs(asDouble(sub[j]))   : 0.0)
+                  + (j > 0   ? std::fabs(asDouble(sup[j-1])) : 0.0));
+    F.st    = tridiagFactor(n, F.sub.data(), diag.data(), sup.data(),
+                            F.P.data(), F.u.data());
+    return F;
+}
+
+template<typename T>
+CroutFactorization<T> Solver::factorTridiagonal(const Matrix<T>& A)
+{
+    const int n = A.size();
+    Vector<T> sub(n > 0 ? n-1 : 0), diag(n), sup(n > 0 ? n-1 : 0);
+    for (int i = 0; i < n; ++i) {
+        diag[i] = A[i][i];
+        if (i < n-1) {
+            sub[i] = A[i + 1][i];
+            sup[i] = A[i][i + 1];
+        }
+    }
+    return factorTridiagonal(sub, diag, sup);
+}
+
+template<typename T>
+void CroutFactorization<T>::solveInPlace(T* x) const
+{
+    if (st)
+        throw std::runtime_error("Faktoryzacja nieudana – pivot zerowy w kroku "
+                                 + std::to_string(st));
+    switch (kind_)
+    {
+    case Kind::Dense:
+        croutSolve(F, x);
+        break;
+
+    case Kind::Symmetric:
+        ldltSolve(P, n, x);
+        break;
+
+    case Kind::Tridiagonal:                             // P = l
+        tridiagSweep(n, sub.data(), P.data(), u.data(), x);
+        break;
+    }
+}
+
+template<typename T>
+void CroutFactorization<T>::solveTransposedInPlace(T* x) const
+{
+    if (st)
+        throw std::runtime_error("Faktoryzacja nieudana – pivot zerowy w kroku "
+                                 + std::to_string(st));
+    switch (kind_)
+    {
+    case Kind::Dense:
+        croutSolveTransposed(F, x);
+        break;
+
+    case Kind::Symmetric:                               // Aᵀ = A
+        ldltSolve(P, n, x);
+        break;
+
+    case Kind::Tridiagonal:
+        tridiagSweepTransposed(n, sub.data(), P.data(), u.data(), x);
+        break;
+    }
+}
+
+/* Hager (1984), z poprawkami Highama (1988, LAPACK xLACN2):
+     x = (1/n,…,1/n);  powtarzaj:
+       y = A⁻¹x,  ξ = sign(y),  z = A⁻ᵀξ,
+       koniec, gdy ‖z‖∞ ≤ zᵀx albo ξ się nie zmienił,
+       inaczej x = e_j,  j = argmax |z_j|.
+   Na końcu jeszcze x_i = (-1)^i·(1 + i/(n-1)), który łapie
+   przypadki, gdzie sama iteracja zatrzymuje się za nisko. */
+template<typename T>
+double CroutFactorization<T>::conditionEstimate() const
+{
+    if (st) return std::numeric_limits<double>::infinity();
+    if (n == 0) return 0.0;
+
+    Vector<T> x(n, T(1.0 / n)), z(n);
+    std::vector<double> xi(n, 0.0);
+    double est = 0.0;
+    int    j   = -1;                                    // x = e_j (-1: 1/n)
+
+    for (int it = 0; it < 5; ++it)
+    {
+        solveInPlace(x);                                // y = A⁻¹x
+        double yn   = 0.0;
+        bool   same = it > 0;
+        for (int i = 0; i < n; ++i) {
+            const double v = asDouble(x[i]);
+            const double s = v >= 0 ? 1.0 : -1.0;
+            yn  += std::fabs(v);
+            same = same && s == xi[i];
+            xi[i] = s;
+            z[i]  = T(s);
+        }
+        if (it > 0 && (same || yn <= est)) { est = std::max(est, yn); break; }
+        est = yn;
+
+        solveTransposedInPlace(z.data());               // z = A⁻ᵀξ
+        double zmax = -1.0, ztx = 0.0;
+        int    jn   = 0;
+        for (int i = 0; i < n; ++i) {
+            const double v = asDouble(z[i]);
+            if (std::fabs(v) > zmax) { zmax = std::fabs(v); jn = i; }
+            if (j < 0) ztx += v / n;
+        }
+        if (j >= 0) ztx = asDouble(z[j]);
+        if (zmax <= ztx) break;
+
+        j = jn;
+        x.assign(n, T(0));
+        x[j] = T(1);
+    }
+
+    for (int i = 0; i < n; ++i)
+        x[i] = T((i % 2 ? -1.0 : 1.0) * (1.0 + (n > 1 ? double(i) / (n - 1) : 0.0)));
+    solveInPlace(x);
+    double alt = 0.0;
+    for (int i = 0; i < n; ++i) alt += std::fabs(asDouble(x[i]));
+    est = std::max(est, 2.0 * alt / (3.0 * n));
+
+    return est * anorm;
+}
+
+template<typename T>
+void CroutFactorization<T>::solveInPlace(Vector<T>& b) const
+{
+    if (int(b.size()) != n)
+        throw std::invalid_argument("Niezgodny rozmiar prawej strony");
+    solveInPlace(b.data());
+}
+
+template<typename T>
+Vector<T> CroutFactorization<T>::solve(const Vector<T>& b) const
+{
+    Vector<T> x(b);
+    solveInPlace(x);
+    return x;
+}
+
+/* -----------------------------------------------------------
+   6.  Wiele prawych stron naraz:  A·X = B,  B – n×k wierszami
+       Podstawienia idą wierszami B, więc każdy krok to axpy
+       po k kolumnach (dla double – jądro SIMD).
+   ----------------------------------------------------------- */
+template<typename T>
+void scaleRow(int k, const T& d, T* x)
+{
+    for (int c = 0; c < k; ++c) x[c] = x[c] / d;
+}
+
+template<typename T>
+void CroutFactorization<T>::solveInPlace(Matrix<T>& B) const
+{
+    if (B.rows() != n)
+        throw std::invalid_argument("Niezgodny rozmiar prawej strony");
+    if (st)
+        throw std::runtime_error("Faktoryzacja nieudana – pivot zerowy w kroku "
+                                 + std::to_string(st));
+    const int k = B.cols();
+    if (n == 0 || k == 0) return;
+
+    switch (kind_)
+    {
+    case Kind::Dense:
+        for (int i = 0; i < n; ++i)                     // LY = B
+        {
+            for (int j = 0; j < i; ++j)
+                kernels::axpy(k, T(-F[i][j]), B[j], B[i]);
+            scaleRow(k, F[i][i], B[i]);
+        }
+        for (int i = n - 1; i >= 0; --i)                // UX = Y
+            for (int j = i + 1; j < n; ++j)
+                kernels::axpy(k, T(-F[i][j]), B[j], B[i]);
+        break;
+
+    case Kind::Symmetric:
+        for (int i = 0; i < n; ++i)                     // LZ = B
+        {
+            const T* Li = &P[packedRow(i)];
+            for (int j = 0; j < i; ++j)
+                kernels::axpy(k, T(-Li[j]), B[j], B[i]);
+        }
+        for (int i = 0; i < n; ++i)                     // DY = Z
+            scaleRow(k, P[packedRow(i) + i], B[i]);
+        for (int i = n - 1; i > 0; --i)                 // LᵀX = Y
+        {
+            const T* Li = &P[packedRow(i)];
+            for (int j = 0; j < i; ++j)
+                kernels::axpy(k, T(-Li[j]), B[i], B[j]);
+        }
+        break;
+
+    case Kind::Tridiagonal:                             // P = l
+        scaleRow(k, P[0], B[0]);
+        for (int i = 1; i < n; ++i)
+        {
+            kernels::axpy(k, T(-sub[i-1]), B[i-1], B[i]);
+            scaleRow(k, P[i], B[i]);
+        }
+        for (int i = n - 2; i >= 0; --i)
+            kernels::axpy(k, T(-u[i]), B[i+1], B[i]);
+        break;
+    }
+}
+
+template<typename T>
+Matrix<T> CroutFactorization<T>::solve(const Matrix<T>& B) const
+{
+    Matrix<T> X(B);
+    solveInPlace(X);
+    return X;
+}
+
+template<typename T>
+Matrix<T> Solver::solveCrout(const Matrix<T>& A, const Matrix<T>& B)
+{
+    const CroutFactorization<T> F = factor(A);
+    if (F.status())
+        throw std::runtime_error("Pivot zero – Crout");
+    return F.solve(B);
+}
+
+template<typename T>
+BlockResult<T> blockResult(const CroutFactorization<T>& F, const Matrix<T>& B)
+{
+    if (F.size() != B.rows())
+        throw std::invalid_argument("Niezgodny rozmiar prawej strony");
+    if (F.status())
+        return { Matrix<T>(B.rows(), B.cols(), T(0)), F.status() };
+    return { F.solve(B), 0 };
+}
+
+template<typename T>
+BlockResult<T> Solver::solveCroutSymmetric(const Matrix<T>& A,
+                                           const Matrix<T>& B)
+{
+    return blockResult(factorSymmetric(A), B);
+}
+
+template<typename T>
+BlockResult<T> Solver::solveCroutTridiagonal(const Matrix<T>& A,
+                                             const Matrix<T>& B)
+{
+    return blockResult(factorTridiagonal(A), B);
+}
+
+template<typename T>
+BlockResult<T> Solver::solveCroutTridiagonal(const Vector<T>& sub,
+                                             const Vector<T>& diag,
+                                             const Vector<T>& sup,
+                                             const Matrix<T>& B)
+{
+    return blockResult(factorTridiagonal(sub, diag, sup), B);
+}
+
+/* -----------------------------------------------------------
+   7.  Partia układów trójdiagonalnych – jeden układ na linię
+       Pętla po układach jest wewnętrzna, więc każdy krok
+       rekurencji czyta ciągły kawałek pamięci.  Dla double
+       pełne grupy linii liczy jądro SIMD, resztę ta pętla;
+       działania są te same co w solveCroutTridiagonalInPlace.
+   ----------------------------------------------------------- */
+template<typename T>
+void tridiagBatchLanes(int n, int batch, int s0, const T* sub,
+                       const T* diag, T* sup, T* b, int* st)
+{
+    const T eps = T(1e-20);
+    const int m = batch - s0;
+    std::vector<T> l(m);
+
+    for (int s = s0; s < batch; ++s)
+    {
+        l[s - s0] = diag[s];
+        st[s] = tinyPivot(l[s - s0], eps) ? 1 : 0;
+        if (n > 1) sup[s] = sup[s] / l[s - s0];
+        b[s] = b[s] / l[s - s0];
+    }
+
+    for (int i = 1; i < n; ++i)
+    {
+        const std::size_t o = std::size_t(i) * batch, p = o - batch;
+        for (int s = s0; s < batch; ++s)
+        {
+            T& li = l[s - s0];
+            li = diag[o + s] - sub[p + s]*sup[p + s];
+            if (st[s] == 0 && tinyPivot(li, eps)) st[s] = i + 1;
+
+            if (i < n-1) sup[o + s] = sup[o + s] / li;
+            b[o + s] = (b[o + s] - sub[p + s]*b[p + s]) / li;
+        }
+    }
+
+    for (int i = n - 2; i >= 0; --i)                    // Ux = y
+    {
+        const std::size_t o = std::size_t(i) * batch, q = o + batch;
+        for (int s = s0; s < batch; ++s)
+            b[o + s] = b[o + s] - sup[o + s]*b[q + s];
+    }
+
+    for (int s = s0; s < batch; ++s)
+        if (st[s])
+            for (int i = 0; i < n; ++i) b[std::size_t(i) * batch + s] = T(0);
+}
+
+template<typename T>
+int Solver::solveCroutTridiagonalBatch(int n, int batch, const T* sub,
+                                       const T* diag, T* sup, T* b, int* st)
+{
+    if (n <= 0 || batch <= 0) {
+        std::fill(st, st + std::max(batch, 0), 0);
+        return 0;
+    }
+
+    int done = 0;
+    if constexpr (std::is_same<T, double>::value)
+        done = kernels::tridiagBatch(n, batch, sub, diag, sup, b, st);
+    if (done < batch)
+        tridiagBatchLanes(n, batch, done, sub, diag, sup, b, st);
+
+    return int(std::count_if(st, st + batch, [](int k) { return k != 0; }));
+}
+
+template<typename T>
+int Solver::solveCroutTridiagonalBatch(TridiagonalBatch<T>& S)
+{
+    return solveCroutTridiagonalBatch(S.size(), S.batch(), S.subData(),
+                                      S.diagData(), S.supData(), S.bData(),
+                                      S.statusData());
+}
+
+/* -----------------------------------------------------------
+   8.  Macierz trójdiagonalna – metoda podziału (SPIKE)
+       Układ dzielimy na P kawałków [s_k, e_k).  Każdy kawałek
+       rozkłada swój blok T_k niezależnie i liczy końce
+           y = T_k⁻¹ b_k,
+           w = T_k⁻¹ (a_{s_k} e_first)   – sprzężenie z x_{s_k-1},
+           v = T_k⁻¹ (c_{e_k-1} e_last)  – sprzężenie z x_{e_k}.
+       Pierwsze i ostatnie niewiadome kawałków spełniają układ
+       zredukowany 2P×2P (pasmo 2+2):
+           x_first + w_first·x_{s_k-1} + v_first·x_{e_k} = y_first
+           x_last  + w_last ·x_{s_k-1} + v_last ·x_{e_k} = y_last
+       a potem każdy kawałek rozwiązuje T_k x_k = b_k z już
+       znanymi sprzężeniami przeniesionymi na prawą stronę.
+       Kawałki idą równolegle na puli wątków (także dla double).
+
+       st:  pivoty bloków to nie pivoty całego układu, więc przy
+       załamaniu w którymkolwiek bloku lub w układzie
+       zredukowanym liczymy zwykłym przebiegiem – st jest wtedy
+       dokładnie tym z solveCroutTridiagonal.
+   ----------------------------------------------------------- */
+template<typename T>
+struct SpikeEnds
+{
+    T w0, wm, v0, vm, y0, ym;
+    bool ok;
+};
+
+template<typename T>
+TriResult<T> Solver::solveCroutTridiagonalParallel(const Vector<T>& sub,
+                                                   const Vector<T>& diag,
+                                                   const Vector<T>& sup,
+                                                   const Vector<T>& b)
+{
+    const int n = diag.size();
+    if (int(b.size()) != n ||
+        (n > 0 && (int(sub.size()) < n-1 || int(sup.size()) < n-1)))
+        throw std::invalid_argument("Niezgodne rozmiary przekątnych");
+
+    const int minPart = std::is_arithmetic<T>::value ? 4096 : 256;
+    const int P = std::min(threadCount(), n / minPart);
+    if (P < 2)
+        return solveCroutTridiagonal(sub, diag, sup, b);
+
+    Vector<T> l(n), u(n), x(n);
+    std::vector<SpikeEnds<T>> ends(P);
+    auto first = [&](int k) { return int(std::int64_t(n) * k / P); };
+
+    runTasks(P, [&](int k) {
+        const int s = first(k), m = first(k + 1) - s;
+        SpikeEnds<T>& E = ends[k];
+        T* xk = x.data() + s;
+
+        E.ok = tridiagFactor(m, sub.data() + s, diag.data() + s, sup.data() + s,
+                             l.data() + s, u.data() + s) == 0;
+        if (!E.ok) return;
+        auto sweep = [&] { tridiagSweep(m, sub.data() + s, l.data() + s,
+                                        u.data() + s, xk); };
+
+        E.w0 = E.wm = E.v0 = E.vm = T(0);
+        if (k > 0) {
+            std::fill(xk, xk + m, T(0));
+            xk[0] = sub[s-1];
+            sweep();
+            E.w0 = xk[0];  E.wm = xk[m-1];
+        }
+        if (k < P-1) {
+            std::fill(xk, xk + m, T(0));
+            xk[m-1] = sup[s+m-1];
+            sweep();
+            E.v0 = xk[0];  E.vm = xk[m-1];
+        }
+        std::copy(b.begin() + s, b.begin() + s + m, xk);
+        sweep();
+        E.y0 = xk[0];  E.ym = xk[m-1];
+    });
+
+    for (const auto& E : ends)
+        if (!E.ok) return solveCroutTridiagonal(sub, diag, sup, b);
+
+    /* układ zredukowany: niewiadome (x_first, x_last) kolejnych kawałków */
+    BandMatrix<T> R(2*P, 2, 2);
+    Vector<T>     r(2*P);
+    for (int k = 0; k < P; ++k)
+    {
+        const SpikeEnds<T>& E = ends[k];
+        const int t = 2*k, d = 2*k + 1;
+        R(t, t) = T(1);  r[t] = E.y0;
+        R(d, d) = T(1);  r[d] = E.ym;
+        if (k > 0)   { R(t, t-1) = E.w0;  R(d, t-1) = E.wm; }
+        if (k < P-1) { R(t, t+2) = E.v0;  R(d, t+2) = E.vm; }
+    }
+    const TriResult<T> z = solveCroutBanded(R, r);
+    if (z.st) return solveCroutTridiagonal(sub, diag, sup, b);
+
+    runTasks(P, [&](int k) {
+        const int s = first(k), m = first(k + 1) - s;
+        T* xk = x.data() + s;
+
+        std::copy(b.begin() + s, b.begin() + s + m, xk);
+        if (k > 0)   xk[0]   = xk[0]   - sub[s-1]  *z.x[2*k - 1];
+        if (k < P-1) xk[m-1] = xk[m-1] - sup[s+m-1]*z.x[2*k + 2];
+        tridiagSweep(m, sub.data() + s, l.data() + s, u.data() + s, xk);
+    });
+    return { x, 0 };
+}
+
 /* -----------------------------------------------------------
-   1.  Pełna macierz – klasyczny LU-Crout
+   9.  Macierz rzadka SYMETRYCZNA – LDLᵀ superwęzłami
+       Wariant lewostronny: superwęzeł s zbiera A, odejmuje
+       wkłady wcześniejszych superwęzłów d, które mają wiersze
+       w kolumnach s (lista link[s]), i rozkłada swój blok
+       kolumnowy gęsto.  Kolumny bloku są ciągłe, więc
+       aktualizacje to axpy (dla double – jądra SIMD).
+       L(r,c) superwęzła leży pod  Lx[lxPtr[s] + c*nr + r],
+       d_j na przekątnej bloku.
+       st – numer kolumny A (od 1) z pierwszym zerowym pivotem
+       w kolejności eliminacji.  Analiza zawsze dokłada postorder
+       drzewa eliminacji, więc i przy Natural kolejność może
+       różnić się od gęstej – przy kilku zerowych pivotach st
+       nie musi być tym samym krokiem co w wersji gęstej.
    ----------------------------------------------------------- */
 template<typename T>
-Vector<T> Solver::solveCrout(const Matrix<T>& A, const Vector<T>& b)
+int sparseLdltFactor(const SparseSymbolic& S, const Vector<T>& Ax,
+                     std::vector<T>& Lx)
 {
-    const int n = A.size();
-    Matrix<T> L(n, Vector<T>(n, T(0)));
-    Matrix<T> U(n, Vector<T>(n, T(0)));
+    const T eps = T(1e-20);
+    const int n = S.n, ns = S.nsuper;
 
-    for (int i = 0; i < n; ++i) U[i][i] = T(1);
+    Lx.assign(S.nnzL(), T(0));
+    std::vector<int> rel(n), next(ns), head(ns, -1), link(ns, -1);
+    Vector<T> work;
 
-    for (int j = 0; j < n; ++j)
+    for (int s = 0; s < ns; ++s)
     {
-        for (int i = j; i < n; ++i)                     // kolumna L
+        const int  f  = S.superStart[s], nc = S.superStart[s + 1] - f;
+        const int* R  = &S.rows[S.rowPtr[s]];
+        const int  nr = S.rowPtr[s + 1] - S.rowPtr[s];
+        T* Ls = &Lx[S.lxPtr[s]];
+
+        for (int r = 0; r < nr; ++r) rel[R[r]] = r;
+
+        for (int c = 0; c < nc; ++c)                    // A → blok
+            for (int q = S.cPtr[f + c]; q < S.cPtr[f + c + 1]; ++q)
+                Ls[std::size_t(c)*nr + rel[S.cRow[q]]] += Ax[S.cSrc[q]];
+
+        /* wkłady superwęzłów potomnych */
+        int d = head[s];
+        head[s] = -1;
+        while (d != -1)
         {
-            T s = T(0);
-            for (int k = 0; k < j; ++k) s += L[i][k]*U[k][j];
-            L[i][j] = A[i][j] - s;
+            const int  dNext = link[d];
+            const int* Rd  = &S.rows[S.rowPtr[d]];
+            const int  nrd = S.rowPtr[d + 1] - S.rowPtr[d];
+            const int  ncd = S.superStart[d + 1] - S.superStart[d];
+            const T*   Ld  = &Lx[S.lxPtr[d]];
+
+            int p1 = next[d], p2 = p1;
+            while (p2 < nrd && Rd[p2] < f + nc) ++p2;
+
+            work.resize(nrd - p1);
+            for (int c = p1; c < p2; ++c)
+            {
+                /* work = Σ_k L_d(r,k)·d_k·L_d(c,k),  r ≥ c */
+                std::fill(work.begin(), work.begin() + (nrd - c), T(0));
+                for (int k = 0; k < ncd; ++k) {
+                    const T* Lk = Ld + std::size_t(k)*nrd;
+                    const T  w  = Lk[c] * Lk[k];
+                    kernels::axpy(nrd - c, w, Lk + c, work.data());
+                }
+                T* Lt = Ls + std::size_t(Rd[c] - f)*nr;
+                for (int r = c; r < nrd; ++r)
+                    Lt[rel[Rd[r]]] = Lt[rel[Rd[r]]] - work[r - c];
+            }
+
+            next[d] = p2;
+            if (p2 < nrd) {
+                const int t = S.superOf[Rd[p2]];
+                link[d] = head[t];
+                head[t] = d;
+            }
+            d = dNext;
         }
-        if (L[j][j] == T(0))
-            throw std::runtime_error("Pivot zero – Crout");
 
-        for (int i = j + 1; i < n; ++i)                 // wiersz U
+        /* gęsty LDLᵀ bloku nr×nc */
+        for (int c = 0; c < nc; ++c)
         {
-            T s = T(0);
-            for (int k = 0; k < j; ++k) s += L[j][k]*U[k][i];
-            U[j][i] = (A[j][i] - s) / L[j][j];
+            T* Lc = Ls + std::size_t(c)*nr;
+            for (int k = 0; k < c; ++k) {
+                const T* Lk = Ls + std::size_t(k)*nr;
+                kernels::axpy(nr - c, T(-(Lk[c] * Lk[k])), Lk + c, Lc + c);
+            }
+            const T dj = Lc[c];
+            if (tinyPivot(dj, eps)) return S.perm[f + c] + 1;
+            for (int r = c + 1; r < nr; ++r) Lc[r] = Lc[r] / dj;
+        }
+
+        next[s] = nc;
+        if (nc < nr) {
+            const int t = S.superOf[R[nc]];
+            link[s] = head[t];
+            head[t] = s;
         }
     }
+    return 0;
+}
 
-    Vector<T> y(n), x(n);
-    for (int i = 0; i < n; ++i)                         // Ly = b
+template<typename T>
+void SparseLDLT<T>::solveInPlace(Vector<T>& b) const
+{
+    if (int(b.size()) != size())
+        throw std::invalid_argument("Niezgodny rozmiar prawej strony");
+    if (st)
+        throw std::runtime_error("Faktoryzacja nieudana – pivot zerowy w kolumnie "
+                                 + std::to_string(st));
+    const int n = size();
+    Vector<T> y(n);
+    for (int k = 0; k < n; ++k) y[k] = b[S->perm[k]];
+
+    for (int s = 0; s < S->nsuper; ++s)                 // Lz = b,  Dy = z
     {
-        T s = T(0);
-        for (int k = 0; k < i; ++k) s += L[i][k]*y[k];
-        y[i] = (b[i] - s) / L[i][i];
+        const int  f  = S->superStart[s], nc = S->superStart[s + 1] - f;
+        const int* R  = &S->rows[S->rowPtr[s]];
+        const int  nr = S->rowPtr[s + 1] - S->rowPtr[s];
+        const T*   Ls = &Lx[S->lxPtr[s]];
+        for (int c = 0; c < nc; ++c) {
+            const T* Lc = Ls + std::size_t(c)*nr;
+            const T  yj = y[f + c];
+            for (int r = c + 1; r < nr; ++r)
+                kernels::mulSub(y[R[r]], Lc[r], yj);
+            y[f + c] = yj / Lc[c];
+        }
     }
-    for (int i = n - 1; i >= 0; --i)                    // Ux = y
+    for (int s = S->nsuper - 1; s >= 0; --s)            // Lᵀx = y
     {
-        T s = T(0);
-        for (int k = i + 1; k < n; ++k) s += U[i][k]*x[k];
-        x[i] = y[i] - s;
+        const int  f  = S->superStart[s], nc = S->superStart[s + 1] - f;
+        const int* R  = &S->rows[S->rowPtr[s]];
+        const int  nr = S->rowPtr[s + 1] - S->rowPtr[s];
+        const T*   Ls = &Lx[S->lxPtr[s]];
+        for (int c = nc - 1; c >= 0; --c) {
+            const T* Lc = Ls + std::size_t(c)*nr;
+            T sum = T(0);
+            for (int r = c + 1; r < nr; ++r) kernels::mulAdd(sum, Lc[r], y[R[r]]);
+            y[f + c] = y[f + c] - sum;
+        }
     }
+    for (int k = 0; k < n; ++k) b[S->perm[k]] = y[k];
+}
+
+template<typename T>
+Vector<T> SparseLDLT<T>::solve(const Vector<T>& b) const
+{
+    Vector<T> x(b);
+    solveInPlace(x);
     return x;
 }
 
+template<typename T>
+SparseLDLT<T> Solver::factorSymmetric(const SparseMatrix<T>& A,
+                                      SparseOrdering ordering)
+{
+    SparseLDLT<T> F;
+    F.S = std::make_shared<const SparseSymbolic>(
+              analyzeSymmetric(A.size(), A.colPtr(), A.rowIdx(), ordering));
+    F.st = sparseLdltFactor(*F.S, A.values(), F.Lx);
+    return F;
+}
+
+template<typename T>
+int Solver::refactorSymmetric(SparseLDLT<T>& F, const SparseMatrix<T>& A)
+{
+    if (!F.S || F.S->n != A.size() ||
+        F.S->aPtr != A.colPtr() || F.S->aRow != A.rowIdx())
+        throw std::invalid_argument("refactorSymmetric: inny wzór macierzy");
+    F.st = sparseLdltFactor(*F.S, A.values(), F.Lx);
+    return F.st;
+}
+
+template<typename T>
+TriResult<T> Solver::solveCroutSymmetric(const SparseMatrix<T>& A,
+                                         const Vector<T>& b)
+{
+    if (int(b.size()) != A.size())
+        throw std::invalid_argument("Niezgodny rozmiar prawej strony");
+    const SparseLDLT<T> F = factorSymmetric(A);
+    if (F.status())
+        return { Vector<T>(A.size(), T(0)), F.status() };
+    return { F.solve(b), 0 };
+}
+
 /* -----------------------------------------------------------
-   2.  Pełna macierz SYMETRYCZNA – z kodem st
+   10. Macierz SYMETRYCZNA w zapisie profilowym – LDLᵀ Crouta
+       Te same rekurencje co w 2., ale wiersz i zaczyna się od
+       f_i, a L[i][k]·L[j][k] ≠ 0 tylko dla k ≥ max(f_i, f_j).
+       W wierszu i najpierw powstaje g_j = L[i][j]·d_j (iloczyn
+       skalarny ciągłych kawałków wierszy i, j), potem dzielenie
+       przez d_j i pivot d_i = a_ii - Σ g_k·L[i][k].
    ----------------------------------------------------------- */
 template<typename T>
-TriResult<T> Solver::solveCroutSymmetric(const Matrix<T>& A,
-                                         const Vector<T>& b)
+int skylineFactor(SkylineMatrix<T>& F)
 {
-    const int n   = A.size();
+    const int n   = F.size();
     const T   eps = T(1e-20);
 
-    Matrix<T> L(n, Vector<T>(n, T(0)));
-    Matrix<T> U(n, Vector<T>(n, T(0)));
-    for (int i = 0; i < n; ++i) U[i][i] = T(1);
+    for (int i = 0; i < n; ++i)
+    {
+        const int fi = F.first(i);
+        T* Li = F.row(i) - fi;                          // Li[k] = F(i,k)
 
-    int st = 0;
+        for (int j = fi; j < i; ++j)                    // g_j = L[i][j]·d_j
+        {
+            const int m  = std::max(fi, F.first(j));
+            const T*  Lj = F.row(j) - F.first(j);
+            Li[j] = Li[j] - kernels::dot(j - m, Li + m, Lj + m);
+        }
 
-    for (int j = 0; j < n; ++j)
+        T s = T(0);
+        for (int j = fi; j < i; ++j) {
+            const T g = Li[j];
+            Li[j] = g / F(j, j);
+            kernels::mulAdd(s, g, Li[j]);
+        }
+        Li[i] = Li[i] - s;
+        if (tinyPivot(Li[i], eps)) return i + 1;
+    }
+    return 0;
+}
+
+template<typename T>
+void skylineSolve(const SkylineMatrix<T>& F, T* x)
+{
+    const int n = F.size();
+    for (int i = 0; i < n; ++i)                         // Lz = b
     {
-        for (int i = j; i < n; ++i)                     // kolumna L
-        {
-            T s = T(0);
-            for (int k = 0; k < j; ++k) s += L[i][k]*U[k][j];
-            L[i][j] = A[i][j] - s;
+        const int fi = F.first(i);
+        x[i] = x[i] - kernels::dot(i - fi, F.row(i), x + fi);
+    }
+    for (int i = 0; i < n; ++i)                         // Dy = z
+        x[i] = x[i] / F(i, i);
+    for (int i = n - 1; i > 0; --i)                     // Lᵀx = y
+    {
+        const int fi = F.first(i);
+        kernels::axpy(i - fi, T(-x[i]), F.row(i), x + fi);
+    }
+}
+
+template<typename T>
+TriResult<T> Solver::solveCroutSkyline(const SkylineMatrix<T>& A,
+                                       const Vector<T>& b)
+{
+    const int n = A.size();
+    if (int(b.size()) != n)
+        throw std::invalid_argument("Niezgodny rozmiar prawej strony");
+
+    SkylineMatrix<T> F(A);
+    const int st = skylineFactor(F);
+    if (st) return { Vector<T>(n, T(0)), st };
+
+    Vector<T> x(b);
+    skylineSolve(F, x.data());
+    return { x, 0 };
+}
+
+template<typename T>
+TriResult<T> Solver::solveCroutSkyline(const SparseMatrix<T>& A,
+                                       const Vector<T>& b,
+                                       SparseOrdering ordering)
+{
+    const int n = A.size();
+    if (int(b.size()) != n)
+        throw std::invalid_argument("Niezgodny rozmiar prawej strony");
+
+    std::vector<int> perm(n);
+    if (ordering == SparseOrdering::ReverseCuthillMcKee)
+        perm = reverseCuthillMcKeeOrder(n, A.colPtr(), A.rowIdx());
+    else if (ordering == SparseOrdering::MinimumDegree)
+        perm = minimumDegreeOrder(n, A.colPtr(), A.rowIdx());
+    else
+        for (int k = 0; k < n; ++k) perm[k] = k;
+
+    SkylineMatrix<T> F(A, perm);
+    const int st = skylineFactor(F);
+    if (st) return { Vector<T>(n, T(0)), perm[st - 1] + 1 };
+
+    Vector<T> y(n), x(n);
+    for (int k = 0; k < n; ++k) y[k] = b[perm[k]];
+    skylineSolve(F, y.data());
+    for (int k = 0; k < n; ++k) x[perm[k]] = y[k];
+    return { x, 0 };
+}
+
+/* -----------------------------------------------------------
+   11. Poprawianie iteracyjne (mieszana precyzja)
+       A i b zaokrąglamy do double i rozkładamy szybką ścieżką
+       (panele + SIMD).  Potem w pętli
+           r  = b - A·x          (mpreal, bieżąca precyzja)
+           δx = F⁻¹ r            (rozkład double)
+           x  = x + δx           (mpreal)
+       Każdy krok zyskuje ok. -log₁₀(κ·2⁻⁵³) cyfr.  Koniec, gdy
+       ‖δx‖∞ ≤ tol·‖x‖∞.  Jeśli poprawka nie maleje co najmniej
+       dwukrotnie (κ·2⁻⁵³ ≳ 1/2), rozkład double się nie nadaje –
+       wtedy pełny rozkład mpreal, jak w zwykłym solverze.
+   ----------------------------------------------------------- */
+
+/* element A widziany przez dany solver */
+template<typename T>
+inline const T& refEntry(const Matrix<T>& A, RefKind kind, int i, int j)
+{
+    return (kind == RefKind::Symmetric && j > i) ? A[j][i] : A[i][j];
+}
+
+mpreal normInf(const Vector<mpreal>& v)
+{
+    mpreal m = 0;
+    for (const mpreal& x : v) m = std::max(m, abs(x));
+    return m;
+}
+
+RefineResult<mpreal> refineFull(const Matrix<mpreal>& A, const Vector<mpreal>& b,
+                                RefKind kind, int iterations)
+{
+    CroutFactorization<mpreal> F =
+        kind == RefKind::Dense     ? Solver::factor(A) :
+        kind == RefKind::Symmetric ? Solver::factorSymmetric(A)
+                                : Solver::factorTridiagonal(A);
+    if (F.status())
+        return { Vector<mpreal>(A.size(), mpreal(0)), F.status(), iterations, true };
+    return { F.solve(b), 0, iterations, true };
+}
+
+RefineResult<mpreal> refineSolve(const Matrix<mpreal>& A, const Vector<mpreal>& b,
+                                 RefKind kind, mpreal tol, int maxIter)
+{
+    const int n = A.size();
+    if (int(b.size()) != n)
+        throw std::invalid_argument("Niezgodny rozmiar prawej strony");
+    if (tol <= 0) tol = mpfr::machine_epsilon();
+
+    /* rozkład w double – poza zakresem double od razu mpreal */
+    Matrix<double> Ad(n, n);
+    for (int i = 0; i < n; ++i)
+        for (int j = 0; j < n; ++j) {
+            Ad[i][j] = A[i][j].toDouble();
+            if (!std::isfinite(Ad[i][j])) return refineFull(A, b, kind, 0);
         }
+    const CroutFactorization<double> F =
+        kind == RefKind::Dense     ? Solver::factor(Ad) :
+        kind == RefKind::Symmetric ? Solver::factorSymmetric(Ad)
+                                : Solver::factorTridiagonal(Ad);
+    if (F.status()) return refineFull(A, b, kind, 0);
 
-        /* —— przerwij tylko przy PIVOCIE ≈ 0 ——————— */
-        if (aabs(L[j][j]) < eps) {
-            st = j + 1;
-            break;
+    Vector<mpreal> x(n, mpreal(0)), r(b);
+    Vector<double> d(n);
+    mpreal prev = -1;
+
+    for (int it = 1; it <= maxIter; ++it)
+    {
+        /* r·2^-e w zakresie double, skala wraca w mpreal */
+        const int e = binExp(normInf(r));
+        if (e == INT_MIN) return { x, 0, it, false };   // r = 0 dokładnie
+        for (int i = 0; i < n; ++i) {
+            scale2(r[i], -e);
+            d[i] = r[i].toDouble();
+        }
+        F.solveInPlace(d);
+
+        mpreal dn = 0;
+        for (int i = 0; i < n; ++i) {
+            if (!std::isfinite(d[i])) return refineFull(A, b, kind, it);
+            mpreal di = d[i];
+            scale2(di, e);
+            x[i] += di;
+            dn = std::max(dn, abs(di));
         }
 
-        for (int i = j + 1; i < n; ++i)                 // wiersz U
+        const mpreal xn = normInf(x);
+        if (dn <= tol*xn) return { x, 0, it, false };
+        if (prev >= 0 && dn > prev/2)                   // zastój:
+        {                                               // daleko za double –
+            if (dn <= sqrt(mpfr::machine_epsilon())*xn) // granica precyzji,
+                return { x, 0, it, false };             // inaczej pełny rozkład
+            return refineFull(A, b, kind, it);
+        }
+        prev = dn;
+
+        for (int i = 0; i < n; ++i)                     // r = b - A·x
         {
-            T s = T(0);
-            for (int k = 0; k < j; ++k) s += L[j][k]*U[k][i];
-            U[j][i] = (A[j][i] - s) / L[j][j];
+            const int j0 = kind == RefKind::Tridiagonal ? std::max(0, i - 1) : 0;
+            const int j1 = kind == RefKind::Tridiagonal ? std::min(n, i + 2) : n;
+            mpreal s = b[i];
+            for (int j = j0; j < j1; ++j) s -= refEntry(A, kind, i, j)*x[j];
+            r[i] = s;
         }
     }
+    return refineFull(A, b, kind, maxIter);
+}
 
-    Vector<T> y(n, T(0)), x(n, T(0));
-    if (st == 0)
-    {
-        for (int i = 0; i < n; ++i)                     // Ly = b
-        {
-            T s = T(0);
-            for (int k = 0; k < i; ++k) s += L[i][k]*y[k];
-            y[i] = (b[i] - s) / L[i][i];
+RefineResult<mpreal> Solver::solveCroutRefined(const Matrix<mpreal>& A,
+                                               const Vector<mpreal>& b,
+                                               const mpreal& tol, int maxIter)
+{
+    RefineResult<mpreal> R = refineSolve(A, b, RefKind::Dense, tol, maxIter);
+    if (R.st)
+        throw std::runtime_error("Pivot zero – Crout");
+    return R;
+}
+
+RefineResult<mpreal> Solver::solveCroutSymmetricRefined(const Matrix<mpreal>& A,
+                                                        const Vector<mpreal>& b,
+                                                        const mpreal& tol, int maxIter)
+{
+    return refineSolve(A, b, RefKind::Symmetric, tol, maxIter);
+}
+
+RefineResult<mpreal> Solver::solveCroutTridiagonalRefined(const Matrix<mpreal>& A,
+                                                          const Vector<mpreal>& b,
+                                                          const mpreal& tol, int maxIter)
+{
+    return refineSolve(A, b, RefKind::Tridiagonal, tol, maxIter);
+}
+
+/* -----------------------------------------------------------
+   12. Otoczka weryfikowana (Krawczyk, styl verifylss Rumpa)
+       Zamiast Crouta na IntervalMP (każde działanie przez
+       przedziały, szerokości rosną z n):
+         R  ≈ mid(A)⁻¹              – rozkład double, zwykły,
+         x̃  ≈ mid(A)⁻¹·mid(b)       – poprawianie z 11. (mpreal),
+         r  ⊇ b - A·x̃               – mpreal, końce RNDD / RNDU,
+       a potem w double zaokrąglanym w górę (Verified.cpp)
+         Y ← R·r + (I - R·A)·Y      z ε-inflacją.
+       Gdy nowe Y leży we wnętrzu starego, x ∈ x̃ + Y dla każdej
+       A ∈ A i b ∈ b.  Szerokość wyniku ~ κ·|r|, czyli przy
+       danych punktowych rzędu precyzji mpreal, nie double.
+   ----------------------------------------------------------- */
+TriResult<IntervalMP> verifiedSolve(const Matrix<IntervalMP>& A,
+                                    const Vector<IntervalMP>& b, RefKind kind)
+{
+    const int n = A.size();
+    if (int(b.size()) != n)
+        throw std::invalid_argument("Niezgodny rozmiar prawej strony");
+    const Vector<IntervalMP> zero(n, IntervalMP(0));
+
+    /* układ środków */
+    Matrix<mpreal> Am(n, n);
+    Matrix<double> Ad(n, n);
+    Vector<mpreal> bm(n);
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            Am[i][j] = median(A[i][j]);
+            Ad[i][j] = Am[i][j].toDouble();
         }
-        for (int i = n - 1; i >= 0; --i)                // Ux = y
+        bm[i] = median(b[i]);
+    }
+
+    const CroutFactorization<double> F =
+        kind == RefKind::Dense     ? Solver::factor(Ad) :
+        kind == RefKind::Symmetric ? Solver::factorSymmetric(Ad)
+                                   : Solver::factorTridiagonal(Ad);
+    if (F.status()) return { zero, F.status() };
+
+    Matrix<double> R(n, n);                             // R = mid(A)⁻¹
+    for (int i = 0; i < n; ++i) R[i][i] = 1.0;
+    F.solveInPlace(R);
+
+    const RefineResult<mpreal> xt = refineSolve(Am, bm, kind, 0, 50);
+    if (xt.st) return { zero, xt.st };
+
+    /* r ⊇ b - A·x̃  i końce A w double (na zewnątrz) */
+    std::vector<double> Alo(std::size_t(n) * n, 0.0), Ahi(std::size_t(n) * n, 0.0);
+    std::vector<double> rlo(n), rhi(n), ylo(n), yhi(n);
+    mpreal t, slo, shi;
+    for (int i = 0; i < n; ++i)
+    {
+        slo = b[i].lower();
+        shi = b[i].upper();
+        const int j0 = kind == RefKind::Tridiagonal ? std::max(0, i - 1) : 0;
+        const int j1 = kind == RefKind::Tridiagonal ? std::min(n, i + 2) : n;
+        for (int j = j0; j < j1; ++j)
         {
-            T s = T(0);
-            for (int k = i + 1; k < n; ++k) s += U[i][k]*x[k];
-            x[i] = y[i] - s;
+            const IntervalMP& a = refEntry(A, kind, i, j);
+            const mpreal&     x = xt.x[j];
+            Alo[std::size_t(i)*n + j] = a.lower().toDouble(MPFR_RNDD);
+            Ahi[std::size_t(i)*n + j] = a.upper().toDouble(MPFR_RNDU);
+
+            const mpreal& aMax = x >= 0 ? a.upper() : a.lower();    // max a·x
+            const mpreal& aMin = x >= 0 ? a.lower() : a.upper();    // min a·x
+            mpfr_mul(t.mpfr_ptr(), aMax.mpfr_srcptr(), x.mpfr_srcptr(), MPFR_RNDU);
+            mpfr_sub(slo.mpfr_ptr(), slo.mpfr_srcptr(), t.mpfr_srcptr(), MPFR_RNDD);
+            mpfr_mul(t.mpfr_ptr(), aMin.mpfr_srcptr(), x.mpfr_srcptr(), MPFR_RNDD);
+            mpfr_sub(shi.mpfr_ptr(), shi.mpfr_srcptr(), t.mpfr_srcptr(), MPFR_RNDU);
         }
+        rlo[i] = slo.toDouble(MPFR_RNDD);
+        rhi[i] = shi.toDouble(MPFR_RNDU);
     }
-    return { x, st };
+
+    if (!verified::krawczyk(n, Alo.data(), Ahi.data(), R.data(),
+                            rlo.data(), rhi.data(), ylo.data(), yhi.data()))
+        return { zero, -1 };
+
+    Vector<IntervalMP> x(n);
+    mpreal lo, hi;
+    for (int i = 0; i < n; ++i) {
+        mpfr_add_d(lo.mpfr_ptr(), xt.x[i].mpfr_srcptr(), ylo[i], MPFR_RNDD);
+        mpfr_add_d(hi.mpfr_ptr(), xt.x[i].mpfr_srcptr(), yhi[i], MPFR_RNDU);
+        x[i] = IntervalMP(lo, hi);
+    }
+    return { x, 0 };
+}
+
+TriResult<IntervalMP> Solver::solveCroutVerified(const Matrix<IntervalMP>& A,
+                                                 const Vector<IntervalMP>& b)
+{
+    return verifiedSolve(A, b, RefKind::Dense);
+}
+
+TriResult<IntervalMP> Solver::solveCroutSymmetricVerified(const Matrix<IntervalMP>& A,
+                                                          const Vector<IntervalMP>& b)
+{
+    return verifiedSolve(A, b, RefKind::Symmetric);
+}
+
+TriResult<IntervalMP> Solver::solveCroutTridiagonalVerified(const Matrix<IntervalMP>& A,
+                                                            const Vector<IntervalMP>& b)
+{
+    return verifiedSolve(A, b, RefKind::Tridiagonal);
 }
 
 /* -----------------------------------------------------------
-   3.  Macierz trójdiagonalna – z kodem st
+   13. Eskalacja arytmetyki:  double → mpreal (rosnąca
+       precyzja) → przedziały
+       Każdy poziom szacuje błąd względny swojego wyniku:
+         double  – jeden krok poprawiania  d = F⁻¹(b - A·x)
+                   z resztą w mpreal,  błąd ≈ ‖d‖∞ / ‖x‖∞,
+         mpreal  – to samo z tym samym czynnikiem double, a gdy
+                   poprawianie musiało przejść na pełny rozkład
+                   (κ·u_double ≥ 1) – różnica z poprzednim
+                   poziomem,
+         przedz. – szerokość otoczki z 12. (ograniczenie ścisłe).
+       Dalej idzie się tylko wtedy, gdy błąd > tol.
    ----------------------------------------------------------- */
-template<typename T>
-TriResult<T> Solver::solveCroutTridiagonal(const Matrix<T>& A,
-                                           const Vector<T>& b)
+
+/* domyślna precyzja mpreal na czas życia obiektu */
+struct PrecisionScope
 {
-    const int n   = A.size();
-    const T   eps = T(1e-20);
+    mp_prec_t saved;
+    explicit PrecisionScope(mp_prec_t p) : saved(mpreal::get_default_prec())
+    { mpreal::set_default_prec(p); }
+    ~PrecisionScope() { mpreal::set_default_prec(saved); }
+};
+
+inline mpreal atPrecision(const mpreal& v, mp_prec_t p)
+{
+    mpreal r(0, p);
+    mpfr_set(r.mpfr_ptr(), v.mpfr_srcptr(), MPFR_RNDN);
+    return r;
+}
+
+/* ‖F⁻¹(b - A·x)‖∞ / ‖x‖∞,  reszta w bieżącej precyzji mpreal.
+   Reszta bywa daleko poniżej zakresu double – przed konwersją
+   dzielimy ją przez 2^e (‖r‖∞ ∈ [2^(e-1), 2^e)), F⁻¹ jest liniowe,
+   więc skalę i iloraz przez ‖x‖∞ odtwarzamy w mpreal; do double
+   idzie dopiero wynik (inaczej zero z niedomiaru = „zbieżne”) */
+double correctionError(const CroutFactorization<double>& F,
+                       const Matrix<mpreal>& A, const Vector<mpreal>& b,
+                       const Vector<mpreal>& x, RefKind kind)
+{
+    const int n = A.size();
+    Vector<mpreal> r(n);
+    mpreal rn = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        const int j0 = kind == RefKind::Tridiagonal ? std::max(0, i - 1) : 0;
+        const int j1 = kind == RefKind::Tridiagonal ? std::min(n, i + 2) : n;
+        mpreal s = b[i];
+        for (int j = j0; j < j1; ++j) s -= refEntry(A, kind, i, j)*x[j];
+        rn = std::max(rn, abs(s));
+        r[i] = std::move(s);
+    }
+    if (rn == 0) return 0;
 
-    std::vector<T> a(n), d(n), c(n);
+    const int e = binExp(rn);
+    Vector<double> d(n);
     for (int i = 0; i < n; ++i) {
-        d[i] = A[i][i];
-        if (i > 0)   a[i] = A[i][i - 1];
-        if (i < n-1) c[i] = A[i][i + 1];
+        scale2(r[i], -e);
+        d[i] = r[i].toDouble();
     }
+    F.solveInPlace(d);
 
-    std::vector<T> l(n), u(n), y(n), x(n);
-    int st = 0;
+    double dn = 0;
+    for (double v : d) {
+        if (!std::isfinite(v)) return std::numeric_limits<double>::infinity();
+        dn = std::max(dn, std::fabs(v));
+    }
+    if (dn == 0) return 0;
+    mpreal err = dn;
+    scale2(err, e);
+    const mpreal xn = normInf(x);                       // x = 0, poprawka ≠ 0:
+    if (xn == 0) return std::numeric_limits<double>::infinity();   // błąd nieograniczony
+    return (err / xn).toDouble();
+}
 
-    l[0] = d[0];
-    if (aabs(l[0]) < eps) st = 1;
-    else
+double relativeDifference(const Vector<mpreal>& x, const Vector<mpreal>& y)
+{
+    mpreal dn = 0;
+    for (std::size_t i = 0; i < x.size(); ++i) dn = std::max(dn, mpreal(aabs(x[i] - y[i])));
+    const mpreal xn = normInf(x);
+    return (xn > 0 ? dn / xn : dn).toDouble();
+}
+
+EscalationResult escalateSolve(const Matrix<mpreal>& A, const Vector<mpreal>& b,
+                               RefKind kind, double tol, bool guaranteed,
+                               int maxPrecision)
+{
+    using Clock = std::chrono::steady_clock;
+    const double inf = std::numeric_limits<double>::infinity();
+
+    const int n = A.size();
+    if (int(b.size()) != n)
+        throw std::invalid_argument("Niezgodny rozmiar prawej strony");
+    if (!(tol > 0))
+        throw std::invalid_argument("Tolerancja musi być dodatnia");
+
+    EscalationResult R{ Vector<mpreal>(n, mpreal(0)), {}, 0, Arithmetic::Double, 53, inf, {} };
+    auto seconds = [](Clock::time_point t0) {
+        return std::chrono::duration<double>(Clock::now() - t0).count();
+    };
+
+    /* --- poziom 1: double -------------------------------------- */
+    auto t0 = Clock::now();
+    Matrix<double> Ad(n, n);
+    Vector<double> bd(n);
+    bool finite = true;
+    for (int i = 0; i < n && finite; ++i) {
+        for (int j = 0; j < n; ++j) {
+            Ad[i][j] = A[i][j].toDouble();
+            finite = finite && std::isfinite(Ad[i][j]);
+        }
+        bd[i] = b[i].toDouble();
+        finite = finite && std::isfinite(bd[i]);
+    }
+
+    CroutFactorization<double> F;
+    int lastSt = 0;
+    Vector<mpreal> prev;                                // wynik poprzedniego poziomu
+    double err = inf;
+    if (finite)
     {
-        u[0] = c[0] / l[0];
-        y[0] = b[0] / l[0];
+        F = kind == RefKind::Dense     ? Solver::factor(Ad) :
+            kind == RefKind::Symmetric ? Solver::factorSymmetric(Ad)
+                                       : Solver::factorTridiagonal(Ad);
+        lastSt = F.status();
+        if (!lastSt) {
+            F.solveInPlace(bd);
+            prev.assign(bd.begin(), bd.end());
+            err = correctionError(F, A, b, prev, kind);
+        }
+    }
+    R.timings.push_back({ Arithmetic::Double, 53, seconds(t0), err });
+    if (err <= tol) {
+        R.x = prev;
+        R.error = err;
+    }
 
-        for (int i = 1; i < n && st == 0; ++i)
+    /* --- poziom 2: mpreal, precyzja podwajana ------------------ */
+    mp_prec_t p = 128;
+    while (p < maxPrecision && std::ldexp(1.0, -int(p) + 32) > tol) p *= 2;
+    if (err > tol)
+    {
+        for (;; p *= 2)
         {
-            l[i] = d[i] - a[i]*u[i-1];
-            if (aabs(l[i]) < eps) { st = i + 1; break; }
+            if (int(p) > maxPrecision) p = maxPrecision;
+            t0 = Clock::now();
+            PrecisionScope scope(p);
+
+            Matrix<mpreal> Ap(n, n);
+            Vector<mpreal> bp(n);
+            for (int i = 0; i < n; ++i) {
+                for (int j = 0; j < n; ++j) Ap[i][j] = atPrecision(A[i][j], p);
+                bp[i] = atPrecision(b[i], p);
+            }
 
-            if (i < n-1) u[i] = c[i] / l[i];
-            y[i] = (b[i] - a[i]*y[i-1]) / l[i];
+            const RefineResult<mpreal> xr = refineSolve(Ap, bp, kind, 0, 50);
+            err = inf;
+            if (!xr.st)
+                err = !xr.fallback && !F.status() && F.size() == n
+                          ? correctionError(F, Ap, bp, xr.x, kind)
+                          : !prev.empty() ? relativeDifference(xr.x, prev) : inf;
+            R.timings.push_back({ Arithmetic::MPReal, int(p), seconds(t0), err });
+
+            if (!xr.st) prev = xr.x;
+            R.tier      = Arithmetic::MPReal;
+            R.precision = int(p);
+            if (err <= tol || int(p) >= maxPrecision ||
+                (xr.st > 0 && xr.st == lastSt))         // pivot zerowy się powtarza
+            {
+                R.st    = xr.st;
+                R.x     = xr.st ? Vector<mpreal>(n, mpreal(0)) : xr.x;
+                R.error = err;
+                break;
+            }
+            lastSt = xr.st;
         }
+        if (R.st) return R;
     }
 
-    if (st == 0)
+    /* --- poziom 3: otoczka (na żądanie) ------------------------ */
+    if (guaranteed)
     {
-        x[n-1] = y[n-1];
-        for (int i = n - 2; i >= 0; --i)
-            x[i] = y[i] - u[i]*x[i+1];
+        t0 = Clock::now();
+        const mp_prec_t pv = R.tier == Arithmetic::Double ? p : mp_prec_t(R.precision);
+        PrecisionScope scope(pv);
+
+        Matrix<IntervalMP> Ai(n, n);
+        Vector<IntervalMP> bi(n);
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < n; ++j) Ai[i][j] = IntervalMP(atPrecision(A[i][j], pv));
+            bi[i] = IntervalMP(atPrecision(b[i], pv));
+        }
+        TriResult<IntervalMP> V = verifiedSolve(Ai, bi, kind);
+
+        double bound = inf;
+        if (!V.st) {
+            mpreal w = 0, xn = 0;
+            for (const IntervalMP& v : V.x) {
+                w  = std::max(w, mpreal(v.upper() - v.lower()));
+                xn = std::max(xn, std::max(aabs(v.lower()), aabs(v.upper())));
+            }
+            bound = (xn > 0 ? w / xn : w).toDouble(MPFR_RNDU);
+        }
+        R.timings.push_back({ Arithmetic::Interval, int(pv), seconds(t0), bound });
+
+        R.enclosure = std::move(V.x);
+        R.st        = V.st;
+        if (!V.st) {
+            R.tier      = Arithmetic::Interval;
+            R.precision = int(pv);
+            R.error     = bound;
+            for (int i = 0; i < n; ++i) R.x[i] = median(R.enclosure[i]);
+        }
     }
-    return { x, st };
+    return R;
+}
+
+EscalationResult Solver::solveCroutToTolerance(const Matrix<mpreal>& A,
+                                               const Vector<mpreal>& b, double tol,
+                                               bool guaranteed, int maxPrecision)
+{
+    return escalateSolve(A, b, RefKind::Dense, tol, guaranteed, maxPrecision);
+}
+
+EscalationResult Solver::solveCroutSymmetricToTolerance(const Matrix<mpreal>& A,
+                                                        const Vector<mpreal>& b, double tol,
+                                                        bool guaranteed, int maxPrecision)
+{
+    return escalateSolve(A, b, RefKind::Symmetric, tol, guaranteed, maxPrecision);
+}
+
+EscalationResult Solver::solveCroutTridiagonalToTolerance(const Matrix<mpreal>& A,
+                                                          const Vector<mpreal>& b, double tol,
+                                                          bool guaranteed, int maxPrecision)
+{
+    return escalateSolve(A, b, RefKind::Tridiagonal, tol, guaranteed, maxPrecision);
 }
 
 /* ---------- jawne instancje szablonów --------------------- */
@@ -187,3 +1900,128 @@ template TriResult<mpreal>
         Solver::solveCroutTridiagonal(const Matrix<mpreal>& ,const Vector<mpreal>&);
 template TriResult<IntervalMP>
         Solver::solveCroutTridiagonal(const Matrix<IntervalMP>& ,const Vector<IntervalMP>&);
+
+template TriResult<double>
+        Solver::solveCroutTridiagonal(const Vector<double>&, const Vector<double>&,
+                                      const Vector<double>&, const Vector<double>&);
+template TriResult<mpreal>
+        Solver::solveCroutTridiagonal(const Vector<mpreal>&, const Vector<mpreal>&,
+                                      const Vector<mpreal>&, const Vector<mpreal>&);
+template TriResult<IntervalMP>
+        Solver::solveCroutTridiagonal(const Vector<IntervalMP>&, const Vector<IntervalMP>&,
+                                      const Vector<IntervalMP>&, const Vector<IntervalMP>&);
+
+template int
+        Solver::solveCroutTridiagonalInPlace(int, const double*, const double*, double*, double*);
+template int
+        Solver::solveCroutTridiagonalInPlace(int, const mpreal*, const mpreal*, mpreal*, mpreal*);
+template int
+        Solver::solveCroutTridiagonalInPlace(int, const IntervalMP*, const IntervalMP*, IntervalMP*, IntervalMP*);
+
+template TriResult<double>
+        Solver::solveCroutBanded(const BandMatrix<double>&, const Vector<double>&);
+template TriResult<mpreal>
+        Solver::solveCroutBanded(const BandMatrix<mpreal>&, const Vector<mpreal>&);
+template TriResult<IntervalMP>
+        Solver::solveCroutBanded(const BandMatrix<IntervalMP>&, const Vector<IntervalMP>&);
+
+template class CroutFactorization<double>;
+template CroutFactorization<double> Solver::factor(const Matrix<double>&);
+template CroutFactorization<double> Solver::factorSymmetric(const Matrix<double>&);
+template CroutFactorization<double> Solver::factorTridiagonal(const Matrix<double>&);
+template CroutFactorization<double>
+        Solver::factorTridiagonal(const Vector<double>&, const Vector<double>&, const Vector<double>&);
+
+template class CroutFactorization<mpreal>;
+template CroutFactorization<mpreal> Solver::factor(const Matrix<mpreal>&);
+template CroutFactorization<mpreal> Solver::factorSymmetric(const Matrix<mpreal>&);
+template CroutFactorization<mpreal> Solver::factorTridiagonal(const Matrix<mpreal>&);
+template CroutFactorization<mpreal>
+        Solver::factorTridiagonal(const Vector<mpreal>&, const Vector<mpreal>&, const Vector<mpreal>&);
+
+template class CroutFactorization<IntervalMP>;
+template CroutFactorization<IntervalMP> Solver::factor(const Matrix<IntervalMP>&);
+template CroutFactorization<IntervalMP> Solver::factorSymmetric(const Matrix<IntervalMP>&);
+template CroutFactorization<IntervalMP> Solver::factorTridiagonal(const Matrix<IntervalMP>&);
+template CroutFactorization<IntervalMP>
+        Solver::factorTridiagonal(const Vector<IntervalMP>&, const Vector<IntervalMP>&, const Vector<IntervalMP>&);
+
+template Matrix<double>
+        Solver::solveCrout(const Matrix<double>&, const Matrix<double>&);
+template BlockResult<double>
+        Solver::solveCroutSymmetric(const Matrix<double>&, const Matrix<double>&);
+template BlockResult<double>
+        Solver::solveCroutTridiagonal(const Matrix<double>&, const Matrix<double>&);
+template BlockResult<double>
+        Solver::solveCroutTridiagonal(const Vector<double>&, const Vector<double>&,
+                                      const Vector<double>&, const Matrix<double>&);
+
+template Matrix<mpreal>
+        Solver::solveCrout(const Matrix<mpreal>&, const Matrix<mpreal>&);
+template BlockResult<mpreal>
+        Solver::solveCroutSymmetric(const Matrix<mpreal>&, const Matrix<mpreal>&);
+template BlockResult<mpreal>
+        Solver::solveCroutTridiagonal(const Matrix<mpreal>&, const Matrix<mpreal>&);
+template BlockResult<mpreal>
+        Solver::solveCroutTridiagonal(const Vector<mpreal>&, const Vector<mpreal>&,
+                                      const Vector<mpreal>&, const Matrix<mpreal>&);
+
+template Matrix<IntervalMP>
+        Solver::solveCrout(const Matrix<IntervalMP>&, const Matrix<IntervalMP>&);
+template BlockResult<IntervalMP>
+        Solver::solveCroutSymmetric(const Matrix<IntervalMP>&, const Matrix<IntervalMP>&);
+template BlockResult<IntervalMP>
+        Solver::solveCroutTridiagonal(const Matrix<IntervalMP>&, const Matrix<IntervalMP>&);
+template BlockResult<IntervalMP>
+        Solver::solveCroutTridiagonal(const Vector<IntervalMP>&, const Vector<IntervalMP>&,
+                                      const Vector<IntervalMP>&, const Matrix<IntervalMP>&);
+
+template int
+        Solver::solveCroutTridiagonalBatch(int, int, const double*, const double*, double*, double*, int*);
+template int
+        Solver::solveCroutTridiagonalBatch(TridiagonalBatch<double>&);
+
+template int
+        Solver::solveCroutTridiagonalBatch(int, int, const mpreal*, const mpreal*, mpreal*, mpreal*, int*);
+template int
+        Solver::solveCroutTridiagonalBatch(TridiagonalBatch<mpreal>&);
+
+template int
+        Solver::solveCroutTridiagonalBatch(int, int, const IntervalMP*, const IntervalMP*, IntervalMP*, IntervalMP*, int*);
+template int
+        Solver::solveCroutTridiagonalBatch(TridiagonalBatch<IntervalMP>&);
+
+template TriResult<double>
+        Solver::solveCroutTridiagonalParallel(const Vector<double>&, const Vector<double>&,
+                                              const Vector<double>&, const Vector<double>&);
+
+template TriResult<mpreal>
+        Solver::solveCroutTridiagonalParallel(const Vector<mpreal>&, const Vector<mpreal>&,
+                                              const Vector<mpreal>&, const Vector<mpreal>&);
+
+template class SparseLDLT<double>;
+template SparseLDLT<double> Solver::factorSymmetric(const SparseMatrix<double>&, SparseOrdering);
+template int Solver::refactorSymmetric(SparseLDLT<double>&, const SparseMatrix<double>&);
+template TriResult<double>
+        Solver::solveCroutSymmetric(const SparseMatrix<double>&, const Vector<double>&);
+
+template class SparseLDLT<mpreal>;
+template SparseLDLT<mpreal> Solver::factorSymmetric(const SparseMatrix<mpreal>&, SparseOrdering);
+template int Solver::refactorSymmetric(SparseLDLT<mpreal>&, const SparseMatrix<mpreal>&);
+template TriResult<mpreal>
+        Solver::solveCroutSymmetric(const SparseMatrix<mpreal>&, const Vector<mpreal>&);
+
+template TriResult<double>
+        Solver::solveCroutSkyline(const SkylineMatrix<double>&, const Vector<double>&);
+template TriResult<double>
+        Solver::solveCroutSkyline(const SparseMatrix<double>&, const Vector<double>&, SparseOrdering);
+
+template TriResult<mpreal>
+        Solver::solveCroutSkyline(const SkylineMatrix<mpreal>&, const Vector<mpreal>&);
+template TriResult<mpreal>
+        Solver::solveCroutSkyline(const SparseMatrix<mpreal>&, const Vector<mpreal>&, SparseOrdering);
+
+template TriResult<IntervalMP>
+        Solver::solveCroutSkyline(const SkylineMatrix<IntervalMP>&, const Vector<IntervalMP>&);
+template TriResult<IntervalMP>
+        Solver::solveCroutSkyline(const SparseMatrix<IntervalMP>&, const Vector<IntervalMP>&, SparseOrdering);
@@ -1,25 +1,21 @@
 #pragma once
 #include <vector>
 #include "mpreal.h"
-#include <boost/numeric/interval.hpp>
-#include <boost/numeric/interval/rounded_transc.hpp>
-#include <boost/numeric/interval/policies.hpp>
+#include "DenseMatrix.h"
+#include "BandMatrix.h"
+#include "TridiagonalBatch.h"
+#include "SparseMatrix.h"
+#include "SparseSymbolic.h"
+#include "SkylineMatrix.h"
+#include "IntervalMP.h"
+#include <memory>
 
 using mpfr::mpreal;
 using namespace boost::numeric;
 
-/* --- przedział mp-real --------------------------------------------------- */
-using IntervalMP = interval<
-    mpreal,
-    interval_lib::policies<
-        interval_lib::save_state<interval_lib::rounded_transc_std<mpreal>>,
-        interval_lib::checking_no_nan<mpreal>
-    >
->;
-
 /* --- aliasy -------------------------------------------------------------- */
 template<typename T>
-using Matrix = std::vector<std::vector<T>>;
+using Matrix = DenseMatrix<T>;          // ciągły blok, wierszami
 
 template<typename T>
 using Vector = std::vector<T>;
@@ -29,19 +25,153 @@ template<typename T>
 struct TriResult
 {
     Vector<T> x;   // wektor rozwiązań (albo 0 przy błędzie)
-    int       st;  // 0 OK,  k>0 – zerowy / niedodatni pivot w kolumnie k
+    int       st;  // 0 OK,  k>0 – zerowy / niedodatni pivot w kolumnie k,
+                   // -1 – otoczki nie udało się udowodnić (wersja Verified)
+    double    cond = 0;  // oszacowanie κ₁(A) z czynników (0 – nie liczone)
+};
+
+/* --- wynik dla wielu prawych stron ------------------------------------- */
+template<typename T>
+struct BlockResult
+{
+    Matrix<T> X;   // kolumny – rozwiązania dla kolumn B (albo 0 przy błędzie)
+    int       st;  // jak TriResult::st
+};
+
+/* --- wynik poprawiania iteracyjnego ------------------------------------ */
+template<typename T>
+struct RefineResult
+{
+    Vector<T> x;            // rozwiązanie (albo 0 przy błędzie)
+    int       st;           // jak TriResult::st
+    int       iterations;   // liczba kroków poprawiania
+    bool      fallback;     // true – rozkład double nie wystarczył,
+                            //        liczone pełnym rozkładem w T
+};
+
+/* --- rozwiązanie z eskalacją arytmetyki -------------------------------- */
+enum class Arithmetic { Double, MPReal, Interval };
+
+struct TierTiming
+{
+    Arithmetic tier;
+    int        precision;   // bity mantysy (double – 53)
+    double     seconds;     // czas tego poziomu
+    double     error;       // oszacowany błąd względny ‖x - x*‖∞ / ‖x‖∞
+};
+
+struct EscalationResult
+{
+    Vector<mpreal>     x;          // rozwiązanie (albo 0 przy błędzie)
+    Vector<IntervalMP> enclosure;  // otoczka – tylko przy żądaniu gwarancji
+    int                st;         // jak TriResult::st
+    Arithmetic         tier;       // poziom, który dał wynik
+    int                precision;  // jego precyzja w bitach
+    double             error;      // oszacowanie błędu względnego wyniku
+    std::vector<TierTiming> timings;  // wszystkie próbowane poziomy, po kolei
+};
+
+/* --- czynniki Crouta do wielokrotnego użytku ---------------------------- */
+template<typename T>
+class CroutFactorization
+{
+public:
+    enum class Kind { Dense, Symmetric, Tridiagonal };
+
+    Kind kind()   const { return kind_; }
+    int  size()   const { return n; }
+    int  status() const { return st; }  // jak TriResult::st
+
+    /* rozwiązanie dla nowego b;  wyjątek, gdy status() ≠ 0 */
+    Vector<T> solve(const Vector<T>& b) const;
+    void      solveInPlace(Vector<T>& b) const;
+    void      solveInPlace(T* b) const;
+
+    /* wiele prawych stron naraz: B – n×k, kolumna = jedno b */
+    Matrix<T> solve(const Matrix<T>& B) const;
+    void      solveInPlace(Matrix<T>& B) const;
+
+    /* Aᵀx = b tymi samymi czynnikami */
+    void      solveTransposedInPlace(T* b) const;
+
+    /* κ₁(A) = ‖A‖₁·‖A⁻¹‖₁ metodą Hagera–Highama: kilka rozwiązań
+       z A i Aᵀ zamiast odwracania, koszt O(n²) / O(n).  Zwykle
+       w granicach czynnika 3 od prawdy;  +∞ gdy status() ≠ 0 */
+    double    conditionEstimate() const;
+
+private:
+    friend class Solver;
+
+    Kind      kind_ = Kind::Dense;
+    int       n     = 0;
+    int       st    = 0;
+    double    anorm = 0;    // ‖A‖₁ z chwili rozkładu
+    Matrix<T> F;            // Dense:       L + U w jednej macierzy
+    Vector<T> P;            // Symmetric:   LDLᵀ spakowane;  Tridiagonal: l_i
+    Vector<T> sub, u;       // Tridiagonal: pod-przekątna i u_i
+};
+
+/* --- rzadki LDLᵀ (superwęzły) ------------------------------------------- */
+template<typename T>
+class SparseLDLT
+{
+public:
+    int  size()   const { return S ? S->n : 0; }
+    int  status() const { return st; }  // jak TriResult::st, kolumna A
+
+    std::size_t nnzL()       const { return S ? S->nnzL() : 0; }
+    int         supernodes() const { return S ? S->nsuper : 0; }
+    const std::vector<int>& permutation() const
+    {
+        static const std::vector<int> none;
+        return S ? S->perm : none;
+    }
+
+    /* rozwiązanie dla nowego b;  wyjątek, gdy status() ≠ 0 */
+    Vector<T> solve(const Vector<T>& b) const;
+    void      solveInPlace(Vector<T>& b) const;
+
+private:
+    friend class Solver;
+
+    std::shared_ptr<const SparseSymbolic> S;    // wspólne przy refaktoryzacji
+    std::vector<T> Lx;                          // bloki superwęzłów, D na przekątnej
+    int st = 0;
 };
 
 /* ======================================================================== */
 class Solver
 {
 public:
-    /* 1) pełna macierz – bez kodu statusu */
+    /* rozmiar kafelka faktoryzacji (0 – dobierany do typu) */
+    static void setBlockSize(int nb) { blockSize_ = nb; }
+    static int  blockSize()          { return blockSize_; }
+
+    /* liczba wątków faktoryzacji mpreal / IntervalMP i kawałków
+       solveCroutTridiagonalParallel (1 – bez wątków) */
+    static void setThreadCount(int n) { threads_ = n > 0 ? n : 1; }
+    static int  threadCount()         { return threads_; }
+
+    /* równoważenie przed solveCrout / solveCroutSymmetric /
+       solveCroutTridiagonal (wersje z Matrix):  A → Dr·A·Dc,
+       Dr, Dc – potęgi dwójki (Ruiz), dla symetrycznej Dr = Dc;
+       x wraca już odskalowane, cond dotyczy macierzy skalowanej */
+    static void setEquilibration(bool on) { equilibrate_ = on; }
+    static bool equilibration()           { return equilibrate_; }
+
+    /* κ₁(A) w TriResult::cond (solveCroutSymmetric / solveCroutTridiagonal
+       z Matrix) – kilka dodatkowych rozwiązań, więc tylko na życzenie;
+       domyślnie cond = 0 */
+    static void setConditionEstimate(bool on) { estimateCond_ = on; }
+    static bool conditionEstimate()           { return estimateCond_; }
+
+    /* 1) pełna macierz – bez kodu statusu (faktoryzacja panelami) */
     template<typename T>
     static Vector<T>
     solveCrout(const Matrix<T>& A, const Vector<T>& b);
 
-    /* 2) pełna macierz SYMETRYCZNA – z kodem statusu (Ta część zmieniona) */
+    /* 2) pełna macierz SYMETRYCZNA – z kodem statusu
+          (LDLᵀ, czyta tylko dolny trójkąt, czynnik spakowany) */
     template<typename T>
     static TriResult<T>
     solveCroutSymmetric(const Matrix<T>& A, const Vector<T>& b);
@@ -50,4 +180,159 @@ public:
     template<typename T>
     static TriResult<T>
     solveCroutTridiagonal(const Matrix<T>& A, const Vector<T>& b);
+
+    /* 3a) trzy przekątne zamiast pełnej macierzy – O(n) pamięci
+           sub[i] = A[i+1][i], diag[i] = A[i][i], sup[i] = A[i][i+1] */
+    template<typename T>
+    static TriResult<T>
+    solveCroutTridiagonal(const Vector<T>& sub, const Vector<T>& diag,
+                          const Vector<T>& sup, const Vector<T>& b);
+
+    /* 3b) w miejscu, bez alokacji: sup ← u, b ← x; zwraca st */
+    template<typename T>
+    static int
+    solveCroutTridiagonalInPlace(int n, const T* sub, const T* diag,
+                                 T* sup, T* b);
+
+    /* 4) macierz pasmowa (p pod, q nad przekątną) – z kodem statusu */
+    template<typename T>
+    static TriResult<T>
+    solveCroutBanded(const BandMatrix<T>& A, const Vector<T>& b);
+
+    /* 5) faktoryzacja raz, rozwiązania wiele razy */
+    template<typename T>
+    static CroutFactorization<T> factor(const Matrix<T>& A);
+
+    template<typename T>
+    static CroutFactorization<T> factorSymmetric(const Matrix<T>& A);
+
+    template<typename T>
+    static CroutFactorization<T> factorTridiagonal(const Matrix<T>& A);
+
+    template<typename T>
+    static CroutFactorization<T>
+    factorTridiagonal(const Vector<T>& sub, const Vector<T>& diag,
+                      const Vector<T>& sup);
+
+    /* 6) wiele prawych stron: A·X = B,  B – n×k */
+    template<typename T>
+    static Matrix<T>
+    solveCrout(const Matrix<T>& A, const Matrix<T>& B);
+
+    template<typename T>
+    static BlockResult<T>
+    solveCroutSymmetric(const Matrix<T>& A, const Matrix<T>& B);
+
+    template<typename T>
+    static BlockResult<T>
+    solveCroutTridiagonal(const Matrix<T>& A, const Matrix<T>& B);
+
+    template<typename T>
+    static BlockResult<T>
+    solveCroutTridiagonal(const Vector<T>& sub, const Vector<T>& diag,
+                          const Vector<T>& sup, const Matrix<T>& B);
+
+    /* 7) partia układów trójdiagonalnych w zapisie przeplatanym
+          (element i układu s pod [i*batch + s]), w miejscu:
+          sup ← u, b ← x, st[s] – status układu s (przy st ≠ 0
+          b układu jest zerowane);  zwraca liczbę układów z st ≠ 0 */
+    template<typename T>
+    static int
+    solveCroutTridiagonalBatch(int n, int batch, const T* sub, const T* diag,
+                               T* sup, T* b, int* st);
+
+    template<typename T>
+    static int solveCroutTridiagonalBatch(TridiagonalBatch<T>& S);
+
+    /* 8) jeden duży układ trójdiagonalny – metoda podziału (SPIKE),
+          threadCount() kawałków liczonych równolegle; double i mpreal */
+    template<typename T>
+    static TriResult<T>
+    solveCroutTridiagonalParallel(const Vector<T>& sub, const Vector<T>& diag,
+                                  const Vector<T>& sup, const Vector<T>& b);
+
+    /* 9) macierz rzadka SYMETRYCZNA – z kodem statusu
+          (czyta tylko dolny trójkąt;  porządek, analiza symboliczna,
+          LDLᵀ superwęzłami;  double i mpreal) */
+    template<typename T>
+    static TriResult<T>
+    solveCroutSymmetric(const SparseMatrix<T>& A, const Vector<T>& b);
+
+    template<typename T>
+    static SparseLDLT<T>
+    factorSymmetric(const SparseMatrix<T>& A,
+                    SparseOrdering ordering = SparseOrdering::MinimumDegree);
+
+    /* nowe wartości przy tym samym wzorze – bez analizy; zwraca st */
+    template<typename T>
+    static int refactorSymmetric(SparseLDLT<T>& F, const SparseMatrix<T>& A);
+
+    /* 10) macierz SYMETRYCZNA w zapisie profilowym – z kodem statusu
+           (LDLᵀ tylko wewnątrz obwiedni wierszy) */
+    template<typename T>
+    static TriResult<T>
+    solveCroutSkyline(const SkylineMatrix<T>& A, const Vector<T>& b);
+
+    /* 10a) z rzadkiej: przestawienie (domyślnie RCM), profil, LDLᵀ;
+            st – kolumna A jak w 9) */
+    template<typename T>
+    static TriResult<T>
+    solveCroutSkyline(const SparseMatrix<T>& A, const Vector<T>& b,
+                      SparseOrdering ordering = SparseOrdering::ReverseCuthillMcKee);
+
+    /* 11) poprawianie iteracyjne: rozkład w double, reszty i poprawki
+           w mpreal, aż  ‖δx‖∞ ≤ tol·‖x‖∞  (tol = 0 – epsilon bieżącej
+           precyzji);  przy zastoju pełny rozkład mpreal */
+    static RefineResult<mpreal>
+    solveCroutRefined(const Matrix<mpreal>& A, const Vector<mpreal>& b,
+                      const mpreal& tol = 0, int maxIter = 50);
+
+    static RefineResult<mpreal>
+    solveCroutSymmetricRefined(const Matrix<mpreal>& A, const Vector<mpreal>& b,
+                               const mpreal& tol = 0, int maxIter = 50);
+
+    static RefineResult<mpreal>
+    solveCroutTridiagonalRefined(const Matrix<mpreal>& A, const Vector<mpreal>& b,
+                                 const mpreal& tol = 0, int maxIter = 50);
+
+    /* 12) weryfikowana otoczka (Krawczyk, styl Rumpa) zamiast Crouta
+           na przedziałach:  x̃ z poprawiania mpreal, reszta b - A·x̃
+           w mpreal z jawnym zaokrągleniem, C = I - R·A i z = R·r
+           w double zaokrąglanym w górę.  st = -1 – nie udowodniono */
+    static TriResult<IntervalMP>
+    solveCroutVerified(const Matrix<IntervalMP>& A, const Vector<IntervalMP>& b);
+
+    static TriResult<IntervalMP>
+    solveCroutSymmetricVerified(const Matrix<IntervalMP>& A,
+                                const Vector<IntervalMP>& b);
+
+    static TriResult<IntervalMP>
+    solveCroutTridiagonalVerified(const Matrix<IntervalMP>& A,
+                                  const Vector<IntervalMP>& b);
+
+    /* 13) „rozwiąż z dokładnością tol”:  najpierw double (błąd z jednego
+           kroku poprawiania z resztą w mpreal), potem mpreal przez
+           poprawianie z 11. przy precyzji podwajanej aż do maxPrecision,
+           a przy guaranteed = true na końcu otoczka z 12.  Domyślna
+           precyzja mpreal wraca do poprzedniej wartości */
+    static EscalationResult
+    solveCroutToTolerance(const Matrix<mpreal>& A, const Vector<mpreal>& b,
+                          double tol, bool guaranteed = false,
+                          int maxPrecision = 4096);
+
+    static EscalationResult
+    solveCroutSymmetricToTolerance(const Matrix<mpreal>& A, const Vector<mpreal>& b,
+                                   double tol, bool guaranteed = false,
+                                   int maxPrecision = 4096);
+
+    static EscalationResult
+    solveCroutTridiagonalToTolerance(const Matrix<mpreal>& A, const Vector<mpreal>& b,
+                                     double tol, bool guaranteed = false,
+                                     int maxPrecision = 4096);
+
+private:
+    static inline int blockSize_ = 0;
+    static inline int threads_   = 1;
+    static inline bool equilibrate_ = false;
+    static inline bool estimateCond_ = false;
 };
@@ -0,0 +1,137 @@
+#pragma once
+/* ============================================================
+ *  SparseMatrix.h  – macierz rzadka n×n w zapisie CSC
+ *
+ *  Kolumna j zajmuje pozycje colPtr[j] … colPtr[j+1]-1:
+ *      A[rowIdx[p]][j] = values[p]
+ *  Wiersze w kolumnie są posortowane i bez powtórzeń.
+ *  CSR tej samej macierzy to CSC jej transpozycji – fromCSR()
+ *  przepisuje ją do CSC.
+ * ============================================================ */
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+#include <algorithm>
+#include "DenseMatrix.h"
+
+template<typename T>
+class SparseMatrix
+{
+public:
+    SparseMatrix() = default;
+
+    /* gotowe tablice CSC (sprawdzane, wiersze w kolumnie sortowane) */
+    SparseMatrix(int n, std::vector<int> colPtr, std::vector<int> rowIdx,
+                 std::vector<T> values)
+        : n_(n), p(std::move(colPtr)), i(std::move(rowIdx)), x(std::move(values))
+    {
+        if (n < 0 || int(p.size()) != n + 1 || p[0] != 0 ||
+            i.size() != x.size() || std::size_t(p[n]) != i.size())
+            throw std::invalid_argument("SparseMatrix: niepoprawne tablice CSC");
+        for (int j = 0; j < n; ++j)
+            if (p[j] > p[j + 1])
+                throw std::invalid_argument("SparseMatrix: niepoprawne tablice CSC");
+        for (int r : i)
+            if (r < 0 || r >= n)
+                throw std::invalid_argument("SparseMatrix: indeks poza zakresem");
+        sortColumns();
+    }
+
+    /* wiersze CSR: A[r][colIdx[q]] = values[q],  q ∈ [rowPtr[r], rowPtr[r+1]) */
+    static SparseMatrix fromCSR(int n, const std::vector<int>& rowPtr,
+                                const std::vector<int>& colIdx,
+                                const std::vector<T>& values)
+    {
+        SparseMatrix t(n, rowPtr, colIdx, values);   // CSC transpozycji
+        return t.transposed();
+    }
+
+    /* trójki (r, c, v); powtórzenia są sumowane */
+    static SparseMatrix fromTriplets(int n, const std::vector<int>& r,
+                                     const std::vector<int>& c,
+                                     const std::vector<T>& v)
+    {
+        if (r.size() != c.size() || r.size() != v.size())
+            throw std::invalid_argument("SparseMatrix: trójki różnej długości");
+
+        std::vector<int> cp(n + 1, 0);
+        for (int cj : c) {
+            if (cj < 0 || cj >= n)
+                throw std::invalid_argument("SparseMatrix: indeks poza zakresem");
+            ++cp[cj + 1];
+        }
+        for (int j = 0; j < n; ++j) cp[j + 1] += cp[j];
+
+        std::vector<int> ri(r.size()), pos(cp.begin(), cp.end() - 1);
+        std::vector<T>   rv(v.size());
+        for (std::size_t k = 0; k < r.size(); ++k) {
+            const int q = pos[c[k]]++;
+            ri[q] = r[k];
+            rv[q] = v[k];
+        }
+        return SparseMatrix(n, std::move(cp), std::move(ri), std::move(rv));
+    }
+
+    /* niezerowe elementy pełnej macierzy */
+    explicit SparseMatrix(const DenseMatrix<T>& A)
+        : n_(A.rows()), p(A.rows() + 1, 0)
+    {
+        if (A.rows() != A.cols())
+            throw std::invalid_argument("SparseMatrix: macierz nie jest kwadratowa");
+        for (int j = 0; j < n_; ++j) {
+            for (int r = 0; r < n_; ++r)
+                if (A(r, j) != T(0)) { i.push_back(r); x.push_back(A(r, j)); }
+            p[j + 1] = int(i.size());
+        }
+    }
+
+    int size() const { return n_; }
+    int rows() const { return n_; }
+    int cols() const { return n_; }
+    int nnz()  const { return int(i.size()); }
+
+    const std::vector<int>& colPtr() const { return p; }
+    const std::vector<int>& rowIdx() const { return i; }
+    const std::vector<T>&   values() const { return x; }
+    std::vector<T>&         values()       { return x; }   // ten sam wzór
+
+    SparseMatrix transposed() const
+    {
+        std::vector<int> c(i.size());
+        for (int j = 0; j < n_; ++j)
+            for (int q = p[j]; q < p[j + 1]; ++q) c[q] = j;
+        return fromTriplets(n_, c, i, x);
+    }
+
+private:
+    /* sortowanie wierszy w kolumnach, sumowanie powtórzeń */
+    void sortColumns()
+    {
+        std::vector<int> ni;  ni.reserve(i.size());
+        std::vector<T>   nx;  nx.reserve(x.size());
+        std::vector<std::pair<int, std::size_t>> col;
+
+        for (int j = 0; j < n_; ++j) {
+            col.clear();
+            for (int q = p[j]; q < p[j + 1]; ++q) col.emplace_back(i[q], q);
+            std::sort(col.begin(), col.end());
+
+            p[j] = int(ni.size());
+            for (std::size_t k = 0; k < col.size(); ++k) {
+                if (k > 0 && col[k].first == col[k - 1].first)
+                    nx.back() += x[col[k].second];
+                else {
+                    ni.push_back(col[k].first);
+                    nx.push_back(x[col[k].second]);
+                }
+            }
+        }
+        p[n_] = int(ni.size());
+        i.swap(ni);
+        x.swap(nx);
+    }
+
+    int n_ = 0;
+    std::vector<int> p{0}, i;
+    std::vector<T>   x;
+};
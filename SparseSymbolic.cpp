@@ -0,0 +1,401 @@
+/* ===========================================================
+ *  SparseSymbolic.cpp
+ * ========================================================= */
+#include "SparseSymbolic.h"
+#include <algorithm>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+/* ---------- wzór górnego trójkąta C = P·A·Pᵀ kolumnami ----
+   kolumna k: wiersze i < k z C(i,k) ≠ 0 (z wpisów A pod
+   przekątną, w obu kierunkach daje to ten sam graf)           */
+void upperPattern(int n, const std::vector<int>& colPtr,
+                  const std::vector<int>& rowIdx,
+                  const std::vector<int>& iperm,
+                  std::vector<int>& up, std::vector<int>& ui)
+{
+    up.assign(n + 1, 0);
+    for (int j = 0; j < n; ++j)
+        for (int q = colPtr[j]; q < colPtr[j + 1]; ++q)
+            if (rowIdx[q] > j)
+                ++up[std::max(iperm[rowIdx[q]], iperm[j]) + 1];
+    for (int k = 0; k < n; ++k) up[k + 1] += up[k];
+
+    ui.resize(up[n]);
+    std::vector<int> pos(up.begin(), up.end() - 1);
+    for (int j = 0; j < n; ++j)
+        for (int q = colPtr[j]; q < colPtr[j + 1]; ++q)
+            if (rowIdx[q] > j) {
+                const int a = iperm[rowIdx[q]], b = iperm[j];
+                ui[pos[std::max(a, b)]++] = std::min(a, b);
+            }
+}
+
+/* ---------- drzewo eliminacji (Liu, z kompresją ścieżek) ---- */
+std::vector<int> eliminationTree(int n, const std::vector<int>& up,
+                                 const std::vector<int>& ui)
+{
+    std::vector<int> parent(n, -1), anc(n, -1);
+    for (int k = 0; k < n; ++k)
+        for (int q = up[k]; q < up[k + 1]; ++q)
+            for (int i = ui[q], next; i != -1 && i < k; i = next) {
+                next   = anc[i];
+                anc[i] = k;
+                if (next == -1) parent[i] = k;
+            }
+    return parent;
+}
+
+/* ---------- porządek postorder lasu ------------------------- */
+std::vector<int> postorder(int n, const std::vector<int>& parent)
+{
+    std::vector<int> head(n, -1), next(n, -1);
+    for (int j = n - 1; j >= 0; --j)                    // dzieci rosnąco
+        if (parent[j] != -1) {
+            next[j] = head[parent[j]];
+            head[parent[j]] = j;
+        }
+
+    std::vector<int> post, stack;
+    post.reserve(n);
+    for (int r = 0; r < n; ++r)
+    {
+        if (parent[r] != -1) continue;
+        stack.push_back(r);
+        while (!stack.empty()) {
+            const int j = stack.back();
+            if (head[j] != -1) {                        // zejdź do dziecka
+                const int c = head[j];
+                head[j] = next[c];
+                stack.push_back(c);
+            } else {
+                stack.pop_back();
+                post.push_back(j);
+            }
+        }
+    }
+    return post;
+}
+
+/* ---------- graf symetryczny wzoru (bez przekątnej), CSR --- */
+void adjacency(int n, const std::vector<int>& colPtr,
+               const std::vector<int>& rowIdx,
+               std::vector<int>& ap, std::vector<int>& ai)
+{
+    ap.assign(n + 1, 0);
+    for (int j = 0; j < n; ++j)
+        for (int q = colPtr[j]; q < colPtr[j + 1]; ++q)
+            if (rowIdx[q] > j) { ++ap[j + 1]; ++ap[rowIdx[q] + 1]; }
+    for (int k = 0; k < n; ++k) ap[k + 1] += ap[k];
+
+    ai.resize(ap[n]);
+    std::vector<int> pos(ap.begin(), ap.end() - 1);
+    for (int j = 0; j < n; ++j)
+        for (int q = colPtr[j]; q < colPtr[j + 1]; ++q)
+            if (rowIdx[q] > j) {
+                ai[pos[j]++]          = rowIdx[q];
+                ai[pos[rowIdx[q]]++] = j;
+            }
+}
+
+/* ---------- BFS po poziomach od r ---------------------------
+   order – kolejność odwiedzin (poziomami), last – początek
+   ostatniego poziomu w order;  zwraca liczbę poziomów - 1     */
+int levels(int r, const std::vector<int>& ap, const std::vector<int>& ai,
+           std::vector<int>& level, std::vector<int>& order, std::size_t& last)
+{
+    order.clear();
+    order.push_back(r);
+    level[r] = 0;
+    last = 0;
+    for (std::size_t h = 0; h < order.size(); ++h) {
+        const int v = order[h];
+        if (level[v] > level[order[last]]) last = h;
+        for (int q = ap[v]; q < ap[v + 1]; ++q)
+            if (level[ai[q]] < 0) {
+                level[ai[q]] = level[v] + 1;
+                order.push_back(ai[q]);
+            }
+    }
+    const int depth = level[order.back()];
+    for (int v : order) level[v] = -1;                  // gotowe na następny BFS
+    return depth;
+}
+
+} // namespace
+
+/* -----------------------------------------------------------
+   Odwrócony Cuthill–McKee
+   Dla każdej składowej: wierzchołek pseudo-peryferyjny
+   (George–Liu – powtarzany BFS od wierzchołka o najmniejszym
+   stopniu z ostatniego poziomu, dopóki rośnie mimośród),
+   potem BFS z sąsiadami dopisywanymi rosnąco po stopniu.
+   Odwrócenie kolejności nie zmienia pasma, a zwykle zmniejsza
+   profil.
+   ----------------------------------------------------------- */
+std::vector<int> reverseCuthillMcKeeOrder(int n, const std::vector<int>& colPtr,
+                                          const std::vector<int>& rowIdx)
+{
+    std::vector<int> ap, ai;
+    adjacency(n, colPtr, rowIdx, ap, ai);
+    auto degree = [&](int v) { return ap[v + 1] - ap[v]; };
+    auto byDegree = [&](int a, int b) {
+        return degree(a) != degree(b) ? degree(a) < degree(b) : a < b;
+    };
+
+    std::vector<int>  level(n, -1), bfs, order, nbr;
+    std::vector<char> placed(n, 0);
+    std::size_t last;
+    order.reserve(n);
+
+    for (int s = 0; s < n; ++s)
+    {
+        if (placed[s]) continue;
+
+        /* start: najmniejszy stopień w składowej, potem George–Liu */
+        levels(s, ap, ai, level, bfs, last);
+        int r = *std::min_element(bfs.begin(), bfs.end(), byDegree);
+        int depth = levels(r, ap, ai, level, bfs, last);
+        for (;;) {
+            const int c = *std::min_element(bfs.begin() + last, bfs.end(), byDegree);
+            const int d = levels(c, ap, ai, level, nbr, last);
+            if (d <= depth) break;
+            r = c;
+            depth = d;
+            bfs.swap(nbr);
+        }
+
+        /* Cuthill–McKee od r */
+        const std::size_t begin = order.size();
+        order.push_back(r);
+        placed[r] = 1;
+        for (std::size_t h = begin; h < order.size(); ++h) {
+            const int v = order[h];
+            nbr.clear();
+            for (int q = ap[v]; q < ap[v + 1]; ++q)
+                if (!placed[ai[q]]) { placed[ai[q]] = 1; nbr.push_back(ai[q]); }
+            std::sort(nbr.begin(), nbr.end(), byDegree);
+            order.insert(order.end(), nbr.begin(), nbr.end());
+        }
+    }
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+/* -----------------------------------------------------------
+   Minimalny stopień na grafie ilorazowym (przybliżony, AMD)
+   Zamiast dopisywać krawędzie wypełnienia, wyeliminowany
+   wierzchołek p staje się „elementem” – kliką Le[p] swoich
+   sąsiadów.  Sąsiedztwo zmiennej i to zmienne var[i] i
+   elementy elem[i]; element wchłonięty przez nowy element
+   znika.  Zamiast dokładnego stopnia (suma zbiorów) – górne
+   oszacowanie Amestoya–Davisa–Duffa:
+       d_i ≈ min( n-k,  d_i + |Lp\i|,
+                  |var[i]| + |Lp\i| + Σ_{e ≠ p} |Le[e] \ Lp| ),
+   gdzie |Le[e] \ Lp| liczone jest raz dla całego Lp.  Element
+   z Le[e] ⊆ Lp jest wchłaniany od razu.  Pamięć nie przekracza
+   wzoru A – kliki wypełnienia nigdy nie są rozpisywane.
+   ----------------------------------------------------------- */
+std::vector<int> minimumDegreeOrder(int n, const std::vector<int>& colPtr,
+                                    const std::vector<int>& rowIdx)
+{
+    std::vector<std::vector<int>> var(n), elem(n), Le(n);
+    for (int j = 0; j < n; ++j)
+        for (int q = colPtr[j]; q < colPtr[j + 1]; ++q)
+            if (rowIdx[q] > j) {
+                var[j].push_back(rowIdx[q]);
+                var[rowIdx[q]].push_back(j);
+            }
+
+    std::vector<int> deg(n);
+    std::set<std::pair<int, int>> queue;                // (stopień, wierzchołek)
+    for (int i = 0; i < n; ++i) {
+        std::sort(var[i].begin(), var[i].end());
+        var[i].erase(std::unique(var[i].begin(), var[i].end()), var[i].end());
+        deg[i] = int(var[i].size());
+        queue.emplace(deg[i], i);
+    }
+
+    std::vector<char> done(n, 0), absorbed(n, 0);
+    std::vector<int>  inLp(n, -1), wTag(n, -1), w(n, 0), order;
+    order.reserve(n);
+
+    while (!queue.empty())
+    {
+        const int p = queue.begin()->second;
+        queue.erase(queue.begin());
+        done[p] = 1;
+        order.push_back(p);
+
+        /* nowy element: sąsiedzi p i zmienne elementów wokół p */
+        std::vector<int>& Lp = Le[p];
+        for (int v : var[p])
+            if (!done[v] && inLp[v] != p) { inLp[v] = p; Lp.push_back(v); }
+        for (int e : elem[p]) {
+            if (absorbed[e]) continue;
+            for (int v : Le[e])
+                if (!done[v] && inLp[v] != p) { inLp[v] = p; Lp.push_back(v); }
+            absorbed[e] = 1;
+            std::vector<int>().swap(Le[e]);
+        }
+        std::vector<int>().swap(var[p]);
+        std::vector<int>().swap(elem[p]);
+
+        /* |Le[e] \ Lp| dla elementów sąsiadujących z Lp */
+        for (int i : Lp)
+            for (int e : elem[i]) {
+                if (absorbed[e]) continue;
+                if (wTag[e] != p) { wTag[e] = p; w[e] = int(Le[e].size()); }
+                --w[e];
+            }
+
+        const int lp = int(Lp.size());
+        for (int i : Lp)
+        {
+            auto& vi = var[i];
+            vi.erase(std::remove_if(vi.begin(), vi.end(),
+                     [&](int v) { return done[v] || inLp[v] == p; }), vi.end());
+
+            auto& ei = elem[i];
+            int ext = 0;
+            for (int e : ei)
+                if (!absorbed[e] && w[e] == 0) absorbed[e] = 1;   // Le[e] ⊆ Lp
+            ei.erase(std::remove_if(ei.begin(), ei.end(),
+                     [&](int e) { return absorbed[e] != 0; }), ei.end());
+            for (int e : ei) ext += w[e];
+            ei.push_back(p);
+
+            const long long bound = std::min<long long>(
+                deg[i] + lp - 1, (long long)vi.size() + lp - 1 + ext);
+            const int d = int(std::min<long long>(bound, n - int(order.size()) - 1));
+
+            queue.erase({deg[i], i});
+            deg[i] = d;
+            queue.emplace(d, i);
+        }
+    }
+    return order;
+}
+
+/* -----------------------------------------------------------
+   Analiza symboliczna
+     1. porządek (naturalny, minimalny stopień albo RCM),
+     2. drzewo eliminacji i postorder – to samo wypełnienie,
+        ale kolumny poddrzew leżą obok siebie,
+     3. liczności kolumn L przez poddrzewa wierszy,
+     4. superwęzły fundamentalne: j dołącza do superwęzła j-1,
+        gdy jest rodzicem j-1, nie ma innych dzieci, a wzór
+        kolumny j-1 to wzór j plus przekątna,
+     5. wzory superwęzłów i mapa wpisów A → kolumny C.
+   ----------------------------------------------------------- */
+SparseSymbolic analyzeSymmetric(int n, const std::vector<int>& colPtr,
+                                const std::vector<int>& rowIdx,
+                                SparseOrdering ordering)
+{
+    if (n < 0 || int(colPtr.size()) != n + 1)
+        throw std::invalid_argument("analyzeSymmetric: niepoprawny wzór CSC");
+
+    SparseSymbolic S;
+    S.n    = n;
+    S.aPtr = colPtr;
+    S.aRow = rowIdx;
+
+    /* 1–2: porządek, potem postorder jego drzewa eliminacji */
+    std::vector<int> perm(n);
+    if (ordering == SparseOrdering::MinimumDegree)
+        perm = minimumDegreeOrder(n, colPtr, rowIdx);
+    else if (ordering == SparseOrdering::ReverseCuthillMcKee)
+        perm = reverseCuthillMcKeeOrder(n, colPtr, rowIdx);
+    else
+        std::iota(perm.begin(), perm.end(), 0);
+
+    std::vector<int> iperm(n), up, ui;
+    for (int k = 0; k < n; ++k) iperm[perm[k]] = k;
+    upperPattern(n, colPtr, rowIdx, iperm, up, ui);
+
+    const std::vector<int> post = postorder(n, eliminationTree(n, up, ui));
+    S.perm.resize(n);
+    S.iperm.resize(n);
+    for (int k = 0; k < n; ++k) S.perm[k] = perm[post[k]];
+    for (int k = 0; k < n; ++k) S.iperm[S.perm[k]] = k;
+
+    upperPattern(n, colPtr, rowIdx, S.iperm, up, ui);
+    S.parent = eliminationTree(n, up, ui);
+
+    /* 3: wiersz k w L to poddrzewo od wpisów C(i,k) do k */
+    std::vector<int> count(n, 1), children(n, 0), mark(n, -1);
+    for (int k = 0; k < n; ++k)
+    {
+        if (S.parent[k] != -1) ++children[S.parent[k]];
+        mark[k] = k;
+        for (int q = up[k]; q < up[k + 1]; ++q)
+            for (int j = ui[q]; mark[j] != k; j = S.parent[j]) {
+                mark[j] = k;
+                ++count[j];
+            }
+    }
+
+    /* 4: superwęzły fundamentalne */
+    S.superOf.resize(n);
+    for (int j = 0; j < n; ++j)
+    {
+        const bool join = j > 0 && S.parent[j - 1] == j && children[j] == 1 &&
+                          count[j - 1] == count[j] + 1;
+        if (!join) S.superStart.push_back(j);
+        S.superOf[j] = int(S.superStart.size()) - 1;
+    }
+    S.nsuper = int(S.superStart.size());
+    S.superStart.push_back(n);
+
+    /* 5: wzór superwęzła = wzór jego pierwszej kolumny */
+    S.rowPtr.assign(S.nsuper + 1, 0);
+    S.lxPtr.assign(S.nsuper + 1, 0);
+    for (int s = 0; s < S.nsuper; ++s) {
+        const int f  = S.superStart[s];
+        const int nc = S.superStart[s + 1] - f;
+        S.rowPtr[s + 1] = S.rowPtr[s] + count[f];
+        S.lxPtr[s + 1]  = S.lxPtr[s] + std::size_t(count[f]) * nc;
+    }
+
+    S.rows.resize(S.rowPtr[S.nsuper]);
+    std::vector<int> fill(S.rowPtr.begin(), S.rowPtr.end() - 1);
+    std::fill(mark.begin(), mark.end(), -1);
+    for (int k = 0; k < n; ++k)                         // k rosnąco → wiersze posortowane
+    {
+        const int sk = S.superOf[k];
+        if (S.superStart[sk] == k)
+            S.rows[fill[sk]++] = k;
+        mark[k] = k;
+        for (int q = up[k]; q < up[k + 1]; ++q)
+            for (int j = ui[q]; mark[j] != k; j = S.parent[j]) {
+                mark[j] = k;
+                const int s = S.superOf[j];
+                if (S.superStart[s] == j) S.rows[fill[s]++] = k;
+            }
+    }
+
+    /* dolny trójkąt C kolumnami, z pozycją wpisu w A */
+    S.cPtr.assign(n + 1, 0);
+    for (int j = 0; j < n; ++j)
+        for (int q = colPtr[j]; q < colPtr[j + 1]; ++q)
+            if (rowIdx[q] >= j)
+                ++S.cPtr[std::min(S.iperm[rowIdx[q]], S.iperm[j]) + 1];
+    for (int k = 0; k < n; ++k) S.cPtr[k + 1] += S.cPtr[k];
+
+    S.cRow.resize(S.cPtr[n]);
+    S.cSrc.resize(S.cPtr[n]);
+    std::vector<int> pos(S.cPtr.begin(), S.cPtr.end() - 1);
+    for (int j = 0; j < n; ++j)
+        for (int q = colPtr[j]; q < colPtr[j + 1]; ++q)
+            if (rowIdx[q] >= j) {
+                const int a = S.iperm[rowIdx[q]], b = S.iperm[j];
+                const int t = pos[std::min(a, b)]++;
+                S.cRow[t] = std::max(a, b);
+                S.cSrc[t] = q;
+            }
+    return S;
+}
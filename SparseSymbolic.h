@@ -0,0 +1,59 @@
+#pragma once
+/* ============================================================
+ *  SparseSymbolic.h  – porządkowanie i analiza symboliczna
+ *                       dla rzadkiego LDLᵀ
+ *
+ *  Nie zależy od typu liczb: pracuje tylko na wzorze dolnego
+ *  trójkąta macierzy (CSC, i ≥ j).  Wynik opisuje czynnik L
+ *  macierzy  C = P·A·Pᵀ  podzielony na superwęzły – grupy
+ *  kolejnych kolumn o wspólnym wzorze pod przekątną.
+ *  Superwęzeł s:
+ *      kolumny      superStart[s] … superStart[s+1]-1
+ *      wiersze      rows[rowPtr[s] … rowPtr[s+1]-1]  (posortowane,
+ *                   najpierw same kolumny superwęzła)
+ *      wartości     blok kolumnowy nr×nc od lxPtr[s]
+ *  Pamięć i czas – proporcjonalne do wypełnienia L, nie do n².
+ * ============================================================ */
+#include <vector>
+#include <cstddef>
+
+enum class SparseOrdering
+{
+    Natural,            // bez przestawień
+    MinimumDegree,      // przybliżony minimalny stopień (AMD)
+    ReverseCuthillMcKee // odwrócony Cuthill–McKee – wąski profil
+};
+
+struct SparseSymbolic
+{
+    int n = 0;
+    std::vector<int> perm;          // perm[k]  – kolumna A na pozycji k
+    std::vector<int> iperm;         // iperm[j] – pozycja kolumny j w C
+    std::vector<int> parent;        // drzewo eliminacji C (-1 – korzeń)
+
+    int nsuper = 0;
+    std::vector<int> superStart;    // nsuper+1
+    std::vector<int> superOf;       // kolumna C → superwęzeł
+    std::vector<int> rowPtr;        // nsuper+1
+    std::vector<int> rows;          // wiersze superwęzłów (indeksy C)
+    std::vector<std::size_t> lxPtr; // nsuper+1, początki bloków wartości
+
+    /* dolny trójkąt C kolumnami: wiersz i miejsce w values() A */
+    std::vector<int> cPtr, cRow, cSrc;
+    std::vector<int> aPtr, aRow;    // wzór A – refaktoryzacja sprawdza, że ten sam
+
+    std::size_t nnzL() const { return lxPtr.empty() ? 0 : lxPtr.back(); }
+};
+
+/* porządek minimalnego stopnia dla wzoru dolnego trójkąta (CSC) */
+std::vector<int> minimumDegreeOrder(int n, const std::vector<int>& colPtr,
+                                    const std::vector<int>& rowIdx);
+
+/* porządek RCM (mała obwiednia) dla wzoru dolnego trójkąta (CSC) */
+std::vector<int> reverseCuthillMcKeeOrder(int n, const std::vector<int>& colPtr,
+                                          const std::vector<int>& rowIdx);
+
+/* pełna analiza: porządek, drzewo eliminacji, superwęzły, wzór L */
+SparseSymbolic analyzeSymmetric(int n, const std::vector<int>& colPtr,
+                                const std::vector<int>& rowIdx,
+                                SparseOrdering ordering);
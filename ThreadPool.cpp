@@ -0,0 +1,85 @@
+/* ===========================================================
+ *  ThreadPool.cpp
+ * ========================================================= */
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool(int threads)
+{
+    for (int i = 1; i < threads; ++i)
+        workers.emplace_back([this] { worker(); });
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lk(m);
+        stop = true;
+    }
+    wake.notify_all();
+    for (auto& t : workers) t.join();
+}
+
+void ThreadPool::run(int tasks, const std::function<void(int)>& f)
+{
+    if (tasks <= 0) return;
+    if (workers.empty() || tasks == 1) {
+        for (int t = 0; t < tasks; ++t) f(t);
+        return;
+    }
+
+    unsigned long gen;
+    {
+        std::lock_guard<std::mutex> lk(m);
+        job      = &f;
+        jobTasks = tasks;
+        next     = 0;
+        pending  = tasks;
+        error    = nullptr;
+        gen      = ++generation;
+    }
+    wake.notify_all();
+
+    execute(gen);
+
+    std::unique_lock<std::mutex> lk(m);
+    done.wait(lk, [this] { return pending == 0; });
+    job = nullptr;
+    if (error) std::rethrow_exception(error);
+}
+
+void ThreadPool::execute(unsigned long gen)
+{
+    std::unique_lock<std::mutex> lk(m);
+    while (generation == gen && next < jobTasks)
+    {
+        const int t = next++;
+        const std::function<void(int)>& f = *job;
+        lk.unlock();
+
+        std::exception_ptr e;
+        try {
+            f(t);
+        } catch (...) {
+            e = std::current_exception();
+        }
+
+        lk.lock();
+        if (e && !error) error = e;
+        if (--pending == 0) done.notify_all();
+    }
+}
+
+void ThreadPool::worker()
+{
+    unsigned long seen = 0;
+    std::unique_lock<std::mutex> lk(m);
+    for (;;)
+    {
+        wake.wait(lk, [&] { return stop || generation != seen; });
+        if (stop) return;
+        seen = generation;
+        lk.unlock();
+        execute(seen);
+        lk.lock();
+    }
+}
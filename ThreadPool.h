@@ -0,0 +1,44 @@
+#pragma once
+/* ============================================================
+ *  ThreadPool.h  – stała pula wątków dla pętli równoległych
+ *
+ *  run(tasks, f) wykonuje f(0), …, f(tasks-1) na wątkach puli
+ *  i na wątku wołającym, wraca po zakończeniu wszystkich.
+ *  Wyjątek z zadania jest przekazywany do wołającego.
+ * ============================================================ */
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool
+{
+public:
+    explicit ThreadPool(int threads);   // łącznie z wątkiem wołającym
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    int size() const { return static_cast<int>(workers.size()) + 1; }
+
+    void run(int tasks, const std::function<void(int)>& f);
+
+private:
+    void worker();
+    void execute(unsigned long gen);    // pobiera zadania aż do wyczerpania
+
+    std::vector<std::thread> workers;
+    std::mutex               m;
+    std::condition_variable  wake, done;
+    unsigned long            generation = 0;
+    bool                     stop       = false;
+
+    const std::function<void(int)>* job = nullptr;
+    int                      jobTasks   = 0;
+    int                      next       = 0;
+    int                      pending    = 0;
+    std::exception_ptr       error;
+};
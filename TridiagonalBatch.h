@@ -0,0 +1,71 @@
+#pragma once
+/* ============================================================
+ *  TridiagonalBatch.h  – wiele niezależnych układów
+ *                         trójdiagonalnych tego samego rozmiaru
+ *
+ *  Zapis przeplatany (structure-of-arrays): element i układu s
+ *  leży pod  [i*batch + s],  więc i-ty krok rekurencji dla
+ *  kolejnych układów to kolejne komórki pamięci – jedna linia
+ *  SIMD na układ.
+ *      sub(i,s)  = A_s[i+1][i]   i < n-1
+ *      diag(i,s) = A_s[i][i]
+ *      sup(i,s)  = A_s[i][i+1]   i < n-1
+ *      b(i,s)    – prawa strona, po rozwiązaniu x
+ *  status(s) – jak TriResult::st dla układu s.
+ * ============================================================ */
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+#include "DenseMatrix.h"
+
+template<typename T>
+class TridiagonalBatch
+{
+public:
+    TridiagonalBatch() = default;
+
+    TridiagonalBatch(int n, int batch)
+        : n_(checkedSize(n, batch)), batch_(batch),
+          sub_ (std::size_t(n > 0 ? n-1 : 0) * batch, T(0)),
+          diag_(std::size_t(n) * batch,               T(0)),
+          sup_ (std::size_t(n > 0 ? n-1 : 0) * batch, T(0)),
+          b_   (std::size_t(n) * batch,               T(0)),
+          st_  (batch, 0)
+    {}
+
+    int size()  const { return n_; }       // liczba niewiadomych układu
+    int batch() const { return batch_; }   // liczba układów
+
+    T& sub (int i, int s) { return sub_ [at(i, s)]; }
+    T& diag(int i, int s) { return diag_[at(i, s)]; }
+    T& sup (int i, int s) { return sup_ [at(i, s)]; }
+    T& b   (int i, int s) { return b_   [at(i, s)]; }
+    const T& sub (int i, int s) const { return sub_ [at(i, s)]; }
+    const T& diag(int i, int s) const { return diag_[at(i, s)]; }
+    const T& sup (int i, int s) const { return sup_ [at(i, s)]; }
+    const T& b   (int i, int s) const { return b_   [at(i, s)]; }
+
+    int  status(int s) const { return st_[s]; }
+
+    T*   subData()    { return sub_.data();  }
+    T*   diagData()   { return diag_.data(); }
+    T*   supData()    { return sup_.data();  }
+    T*   bData()      { return b_.data();    }
+    int* statusData() { return st_.data();   }
+
+private:
+    std::size_t at(int i, int s) const { return std::size_t(i) * batch_ + s; }
+
+    /* sprawdzenie PRZED alokacją (n_ inicjowane jako pierwsze) –
+       ujemny rozmiar jako size_t dałby length_error */
+    static int checkedSize(int n, int batch)
+    {
+        if (n < 0 || batch < 0)
+            throw std::invalid_argument("TridiagonalBatch: ujemny rozmiar");
+        return n;
+    }
+
+    int n_ = 0, batch_ = 0;
+    std::vector<T, AlignedAllocator<T>> sub_, diag_, sup_, b_;
+    std::vector<int> st_;
+};
@@ -0,0 +1,246 @@
+/* ===========================================================
+ *  Verified.cpp  – rdzeń weryfikacji w double, zaokrąglanie
+ *                  w górę
+ * ========================================================= */
+#include "Verified.h"
+#include "Kernels.h"
+#include <cfenv>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+/* kompilator nie może zakładać zaokrąglania do najbliższej */
+#pragma GCC optimize("rounding-math")
+
+namespace verified {
+namespace {
+
+using Mat = std::vector<double>;
+
+/* tryb FE_UPWARD na czas życia obiektu */
+struct RoundUp
+{
+    int saved;
+    RoundUp()  : saved(std::fegetround()) { std::fesetround(FE_UPWARD); }
+    ~RoundUp() { std::fesetround(saved); }
+};
+
+inline double down(double a, double b) { return -((-a) + b); }   // a - b w dół
+inline std::size_t at(int cols, int i, int j) { return std::size_t(i) * cols + j; }
+
+/* P = X·Yᵀ w górę;  X – rows×k,  Yt – cols×k (wiersze to kolumny
+   drugiego czynnika) */
+void mulUp(int rows, int k, int cols, const Mat& X, const Mat& Yt, Mat& P)
+{
+    P.resize(std::size_t(rows) * cols);
+    for (int i = 0; i < rows; ++i)
+        for (int j = 0; j < cols; ++j)
+            P[at(cols, i, j)] = kernels::dot(k, &X[at(k, i, 0)], &Yt[at(k, j, 0)]);
+}
+
+/* [lo, hi] ⊇ M·v  dla M = [Mm ± Mr] (nMm = -Mm, aMm = |Mm|),  v = [vm ± vr];
+   M – rows×k */
+void mulVec(int rows, int k, const Mat& Mm, const Mat& nMm, const Mat& aMm, const Mat* Mr,
+            const double* vm, const double* vr, double* lo, double* hi)
+{
+    std::vector<double> av(k);
+    for (int j = 0; j < k; ++j) av[j] = std::fabs(vm[j]) + vr[j];
+
+    for (int i = 0; i < rows; ++i)
+    {
+        const double up  =  kernels::dot(k, &Mm [at(k, i, 0)], vm);
+        const double dn  = -kernels::dot(k, &nMm[at(k, i, 0)], vm);
+        double rad = kernels::dot(k, &aMm[at(k, i, 0)], vr);
+        if (Mr) rad = kernels::dot(k, &(*Mr)[at(k, i, 0)], av.data(), rad);
+        lo[i] = down(dn, rad);
+        hi[i] = up + rad;
+    }
+}
+
+/* środek i promień przedziału, [m - r, m + r] ⊇ [lo, hi] */
+inline void midRad(double lo, double hi, double& m, double& r)
+{
+    m = 0.5*(lo + hi);
+    r = m - lo;
+}
+
+/* Mt = Mᵀ  (M – rows×cols) */
+void transpose(int rows, int cols, const Mat& M, Mat& Mt)
+{
+    Mt.resize(M.size());
+    for (int i = 0; i < rows; ++i)
+        for (int j = 0; j < cols; ++j)
+            Mt[at(rows, j, i)] = M[at(cols, i, j)];
+}
+
+bool allZero(const Mat& v)
+{
+    for (double x : v) if (x != 0.0) return false;
+    return true;
+}
+
+} // namespace
+
+/* --- IntervalMatrix ------------------------------------------------------ */
+IntervalMatrix::IntervalMatrix(int r, int c)
+    : rows(r), cols(c), mid(std::size_t(r) * c, 0.0), rad(std::size_t(r) * c, 0.0)
+{}
+
+IntervalMatrix IntervalMatrix::fromBounds(int rows, int cols, const double* lo, const double* hi)
+{
+    RoundUp guard;
+    IntervalMatrix A(rows, cols);
+    for (std::size_t k = 0; k < A.mid.size(); ++k) midRad(lo[k], hi[k], A.mid[k], A.rad[k]);
+    return A;
+}
+
+IntervalMatrix IntervalMatrix::point(int rows, int cols, const double* a)
+{
+    IntervalMatrix A(rows, cols);
+    A.mid.assign(a, a + A.mid.size());
+    return A;
+}
+
+void IntervalMatrix::bounds(double* lo, double* hi) const
+{
+    RoundUp guard;
+    for (std::size_t k = 0; k < mid.size(); ++k) {
+        lo[k] = down(mid[k], rad[k]);
+        hi[k] = mid[k] + rad[k];
+    }
+}
+
+bool IntervalMatrix::isPoint() const { return allZero(rad); }
+
+IntervalMatrix mul(const IntervalMatrix& A, const IntervalMatrix& B)
+{
+    if (A.cols != B.rows)
+        throw std::invalid_argument("IntervalMatrix: niezgodne wymiary iloczynu");
+    RoundUp guard;
+    const int n = A.rows, k = A.cols, m = B.cols;
+    const std::size_t nk = std::size_t(n) * k;
+
+    /* mid(A)·mid(B) ∈ [-Pd, Pu] */
+    Mat BmT, nAm(nk), Pu, Pd;
+    transpose(k, m, B.mid, BmT);
+    for (std::size_t t = 0; t < nk; ++t) nAm[t] = -A.mid[t];
+    mulUp(n, k, m, A.mid, BmT, Pu);
+    mulUp(n, k, m, nAm,   BmT, Pd);                     // Pd = -(dolne)
+
+    IntervalMatrix C(n, m);
+    for (std::size_t t = 0; t < C.mid.size(); ++t) midRad(-Pd[t], Pu[t], C.mid[t], C.rad[t]);
+    { Mat().swap(nAm); Mat().swap(Pu); Mat().swap(Pd); }
+
+    Mat Q;
+    if (!B.isPoint()) {                                 // |mid(A)|·rad(B)
+        Mat aAm(nk), BrT;
+        for (std::size_t t = 0; t < nk; ++t) aAm[t] = std::fabs(A.mid[t]);
+        transpose(k, m, B.rad, BrT);
+        mulUp(n, k, m, aAm, BrT, Q);
+        for (std::size_t t = 0; t < Q.size(); ++t) C.rad[t] = C.rad[t] + Q[t];
+    }
+    if (!A.isPoint()) {                                 // rad(A)·(|mid(B)| + rad(B))
+        for (std::size_t t = 0; t < BmT.size(); ++t) BmT[t] = std::fabs(BmT[t]);
+        if (!B.isPoint()) {
+            Mat BrT;
+            transpose(k, m, B.rad, BrT);
+            for (std::size_t t = 0; t < BmT.size(); ++t) BmT[t] = BmT[t] + BrT[t];
+        }
+        mulUp(n, k, m, A.rad, BmT, Q);
+        for (std::size_t t = 0; t < Q.size(); ++t) C.rad[t] = C.rad[t] + Q[t];
+    }
+    return C;
+}
+
+void mul(const IntervalMatrix& A, const double* xlo, const double* xhi,
+         double* ylo, double* yhi)
+{
+    RoundUp guard;
+    const int n = A.rows, k = A.cols;
+    const std::size_t nk = std::size_t(n) * k;
+
+    Mat nAm(nk), aAm(nk);
+    for (std::size_t t = 0; t < nk; ++t) { nAm[t] = -A.mid[t]; aAm[t] = std::fabs(A.mid[t]); }
+
+    std::vector<double> xm(k), xr(k);
+    for (int j = 0; j < k; ++j) midRad(xlo[j], xhi[j], xm[j], xr[j]);
+    mulVec(n, k, A.mid, nAm, aAm, A.isPoint() ? nullptr : &A.rad,
+           xm.data(), xr.data(), ylo, yhi);
+}
+
+/* --- Krawczyk ------------------------------------------------------------ */
+bool krawczyk(int n, const double* Alo, const double* Ahi, const double* R,
+              const double* rlo, const double* rhi,
+              double* ylo, double* yhi, int maxIter)
+{
+    const std::size_t nn = std::size_t(n) * n;
+    const IntervalMatrix Ri = IntervalMatrix::point(n, n, R);
+
+    RoundUp guard;
+
+    /* A w postaci środek–promień, transponowana (kolumny ciągłe) */
+    Mat AmT(nn), ArT(nn);
+    for (int i = 0; i < n; ++i)
+        for (int j = 0; j < n; ++j)
+            midRad(Alo[at(n, i, j)], Ahi[at(n, i, j)], AmT[at(n, j, i)], ArT[at(n, j, i)]);
+
+    /* C = I - R·A:  R·Am ∈ [-Pd, Pu],  |R|·Ar ≤ Q.  Końce C prosto
+       z Pu, Pd, Q – bez pośredniego R·A w postaci środek–promień
+       (mul), które dokładałoby jedno zaokrąglenie */
+    Mat nR(nn), aR(nn), Pu, Pd, Q;
+    for (std::size_t k = 0; k < nn; ++k) { nR[k] = -R[k]; aR[k] = std::fabs(R[k]); }
+    mulUp(n, n, n, Ri.mid, AmT, Pu);
+    mulUp(n, n, n, nR,     AmT, Pd);                    // Pd = -(dolne R·Am)
+    mulUp(n, n, n, aR,     ArT, Q);
+    { Mat().swap(AmT); Mat().swap(ArT); Mat().swap(nR); Mat().swap(aR); }
+
+    Mat Cm(nn), Cr(nn), nC(nn), aC(nn);
+    for (int i = 0; i < n; ++i)
+        for (int j = 0; j < n; ++j) {
+            const std::size_t k = at(n, i, j);
+            const double e  = i == j ? 1.0 : 0.0;
+            const double hi = e + Pd[k] + Q[k];                 // I - dolne + Q
+            const double lo = -((Pu[k] - e) + Q[k]);            // I - górne - Q
+            midRad(lo, hi, Cm[k], Cr[k]);
+            nC[k] = -Cm[k];
+            aC[k] = std::fabs(Cm[k]);
+        }
+    { Mat().swap(Pu); Mat().swap(Pd); Mat().swap(Q); }
+
+    /* z = R·r */
+    std::vector<double> zlo(n), zhi(n);
+    mul(Ri, rlo, rhi, zlo.data(), zhi.data());
+
+    /* Y ← z + C·Y z ε-inflacją, aż nowe Y leży we wnętrzu starego */
+    std::vector<double> lo(zlo), hi(zhi), ym(n), yr(n), clo(n), chi(n);
+    for (int it = 0; it < maxIter; ++it)
+    {
+        for (int i = 0; i < n; ++i) {
+            const double w = hi[i] - lo[i];
+            lo[i] = down(lo[i], 0.1*w + DBL_MIN);
+            hi[i] = hi[i] + (0.1*w + DBL_MIN);
+            midRad(lo[i], hi[i], ym[i], yr[i]);
+        }
+        mulVec(n, n, Cm, nC, aC, &Cr, ym.data(), yr.data(), clo.data(), chi.data());
+
+        bool inside = true;
+        for (int i = 0; i < n; ++i) {
+            const double nlo = -((-zlo[i]) - clo[i]);
+            const double nhi = zhi[i] + chi[i];
+            inside = inside && lo[i] < nlo && nhi < hi[i];
+            clo[i] = nlo;
+            chi[i] = nhi;
+        }
+        if (inside) {
+            for (int i = 0; i < n; ++i) { ylo[i] = clo[i]; yhi[i] = chi[i]; }
+            return true;
+        }
+        lo.swap(clo);
+        hi.swap(chi);
+    }
+    return false;
+}
+
+} // namespace verified
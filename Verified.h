@@ -0,0 +1,56 @@
+#pragma once
+/* ============================================================
+ *  Verified.h  – weryfikacja otoczki rozwiązania (styl Rumpa)
+ *
+ *  Rdzeń w double z zaokrąglaniem w górę (fesetround):
+ *  dolne końce liczone jako  -((-a)·b),  więc wystarcza jeden
+ *  tryb, a jądra dot (SIMD, FMA, dowolna kolejność sumowania)
+ *  dają poprawne ograniczenia górne.  Wszystkie macierze
+ *  wierszami.
+ * ============================================================ */
+
+#include <vector>
+
+namespace verified {
+
+/* Macierz przedziałowa w postaci środek–promień (Rump):
+   A = [mid ± rad],  rad ≥ 0,  wierszami.  Iloczyn to kilka
+   zwykłych iloczynów double (jądro dot) w jednym trybie – w górę –
+   zamiast działań na końcach element po elemencie:
+       mid, rad  ⊇  mid(A)·mid(B)          (dwa iloczyny)
+       rad      +=  |mid(A)|·rad(B) + rad(A)·(|mid(B)| + rad(B))
+   Przeszacowanie względem iloczynu na końcach najwyżej 1.5×. */
+struct IntervalMatrix
+{
+    int rows = 0, cols = 0;
+    std::vector<double> mid, rad;
+
+    IntervalMatrix() = default;
+    IntervalMatrix(int rows, int cols);
+
+    /* najmniejsza [mid ± rad] ⊇ [lo, hi]  /  macierz punktowa */
+    static IntervalMatrix fromBounds(int rows, int cols, const double* lo, const double* hi);
+    static IntervalMatrix point(int rows, int cols, const double* a);
+
+    /* końce, zaokrąglone na zewnątrz */
+    void bounds(double* lo, double* hi) const;
+
+    bool isPoint() const;
+};
+
+/* C ⊇ A·B */
+IntervalMatrix mul(const IntervalMatrix& A, const IntervalMatrix& B);
+
+/* [ylo, yhi] ⊇ A·[xlo, xhi] */
+void mul(const IntervalMatrix& A, const double* xlo, const double* xhi,
+         double* ylo, double* yhi);
+
+/* Krawczyk z ε-inflacją dla  A·y = r,  A ∈ [Alo, Ahi],  r ∈ [rlo, rhi],
+   R – przybliżona odwrotność środka A.  Przy powodzeniu (true)
+   każda A z przedziału jest nieosobliwa i każde rozwiązanie
+   leży w [ylo, yhi]. */
+bool krawczyk(int n, const double* Alo, const double* Ahi, const double* R,
+              const double* rlo, const double* rhi,
+              double* ylo, double* yhi, int maxIter = 10);
+
+} // namespace verified
@@ -1,13 +1,18 @@
 #include <QApplication>
 #include "MainWindow.h"
+#include "Solver.h"
+#include "LimbPool.h"
+#include <thread>
 #include <mpreal.h>
 #include "Interval.h"
 using mpfr::mpreal;
 using namespace interval_arithmetic;
 
 int main(int argc, char *argv[]) {
+    installLimbPool();              // limby mpfr z płyt – przed pierwszym mpreal
     Interval<mpreal>::Initialize();
     mpreal::set_default_prec(256);  // zwiększona precyzja dla wszystkich zmiennych mpreal
+    Solver::setThreadCount(std::thread::hardware_concurrency());   // faktoryzacja mpreal / interval
 
     QApplication app(argc, argv);
     MainWindow window;
@@ -6,12 +6,28 @@ SOURCES += main.cpp \
            MainWindow.cpp \
            MatrixInputWidget.cpp \
            Parser.cpp \
-           Solver.cpp
+           Solver.cpp \
+           Kernels.cpp \
+           ThreadPool.cpp \
+           SparseSymbolic.cpp \
+           Verified.cpp \
+           LimbPool.cpp
 
 HEADERS += MainWindow.h \
            MatrixInputWidget.h \
            Parser.h \
-           Solver.h
+           Solver.h \
+           DenseMatrix.h \
+           BandMatrix.h \
+           TridiagonalBatch.h \
+           SparseMatrix.h \
+           SparseSymbolic.h \
+           SkylineMatrix.h \
+           Verified.h \
+           IntervalMP.h \
+           LimbPool.h \
+           Kernels.h \
+           ThreadPool.h
 
 INCLUDEPATH += ./boost/boost_1_88_0
 LIBS += -lgmp -lmpfr
@@ -0,0 +1,92 @@
+/* ===========================================================
+ *  kernels_test.cpp  – SIMD dot / axpy kontra wersja skalarna
+ *
+ *  Dla każdego poziomu ISA, który ma procesor, i n = 0..300
+ *  (losowe dane):
+ *    axpy – wynik bitowo równy skalarnemu,
+ *    dot  – |dot_simd - dot_scalar| ≤ 2·γ_m · (|s| + Σ|x_k·y_k|),
+ *           m = n + 1 składników,  γ_m = m·u / (1 - m·u).
+ *  Kod wyjścia ≠ 0 przy pierwszym błędzie poziomu.
+ * ========================================================= */
+#include "Kernels.h"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using kernels::Isa;
+
+namespace {
+
+constexpr int MaxN = 300;
+
+double gamma(int m)
+{
+    const double u = std::ldexp(1.0, -53);
+    return m*u / (1.0 - m*u);
+}
+
+int checkIsa(Isa isa)
+{
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    int failures = 0;
+
+    for (int n = 0; n <= MaxN; ++n)
+    {
+        std::vector<double> x(n), y(n);
+        for (int k = 0; k < n; ++k) { x[k] = dist(gen); y[k] = dist(gen); }
+        const double s = n % 2 ? dist(gen) : 0.0;
+        const double a = dist(gen);
+
+        /* odniesienie skalarne */
+        kernels::setIsa(Isa::Scalar);
+        const double dRef = kernels::dot(n, x.data(), y.data(), s);
+        std::vector<double> yRef(y);
+        kernels::axpy(n, a, x.data(), yRef.data());
+
+        kernels::setIsa(isa);
+        const double d = kernels::dot(n, x.data(), y.data(), s);
+        std::vector<double> ySimd(y);
+        kernels::axpy(n, a, x.data(), ySimd.data());
+
+        double absSum = std::fabs(s);
+        for (int k = 0; k < n; ++k) absSum += std::fabs(x[k]*y[k]);
+        const double bound = 2.0*gamma(n + 1)*absSum;
+
+        if (std::fabs(d - dRef) > bound) {
+            std::printf("  %s: dot n=%d  |%.17g - %.17g| > %.3g\n",
+                        kernels::isaName(isa), n, d, dRef, bound);
+            ++failures;
+        }
+        if (n && std::memcmp(ySimd.data(), yRef.data(), n*sizeof(double)) != 0) {
+            std::printf("  %s: axpy n=%d  wynik różni się od skalarnego\n",
+                        kernels::isaName(isa), n);
+            ++failures;
+        }
+    }
+    return failures;
+}
+
+} // namespace
+
+int main()
+{
+    const Isa levels[] = { Isa::Scalar, Isa::AVX2, Isa::AVX512 };
+    const Isa detected = kernels::detectedIsa();
+    int failures = 0;
+
+    for (Isa isa : levels)
+    {
+        if (static_cast<int>(isa) > static_cast<int>(detected)) {
+            std::printf("%-8s pominięty (brak w procesorze)\n", kernels::isaName(isa));
+            continue;
+        }
+        const int f = checkIsa(isa);
+        std::printf("%-8s %s\n", kernels::isaName(isa), f ? "BŁĄD" : "OK");
+        failures += f;
+    }
+    kernels::setIsa(detected);
+    return failures ? 1 : 0;
+}